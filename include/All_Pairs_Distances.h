@@ -0,0 +1,212 @@
+//***************************************************************
+// File: All_Pairs_Distances.h
+// Description:
+//   All-pairs hop distances (unweighted APSP) written to a compact
+//   on-disk matrix, plus a reader that maps the matrix back.
+//
+//   Every vertex is a source. Sources run in batches of 64 through
+//   the bit-parallel BFS kernel (Multi_Source_BFS_Engine.h), each
+//   worker thread reusing one workspace for all of its batches. The
+//   rows of a batch are consecutive in the file, so a worker fills
+//   one contiguous block of the memory-mapped output per batch.
+//
+// File Layout (native byte order):
+//   [0, 64)          DistanceMatrixHeader
+//   rowsPosition     V rows of V entries (uint8 or uint16), row s
+//                    holding the distances from s; page aligned
+//
+// Entries:
+//   - 0 .. limit - 1   exact distance
+//   - limit            distance >= limit (saturated)
+//   - limit + 1        unreachable (the all-ones value)
+//   where limit is 254 for 8-bit and 65534 for 16-bit entries
+//
+// Example:
+//   AllPairsOptions options;
+//   options.entryBytes = 1;
+//   computeAllPairsDistances(g, "g.apd", options);
+//   DistanceMatrix matrix;
+//   matrix.open("g.apd");
+//   int d = matrix.distance(s, t);
+//
+// Notes:
+//   - The output is a MAP_SHARED file mapping, so the matrix may be
+//     larger than RAM: finished pages are written back by the kernel
+//   - Space for the whole file is reserved up front, so a full disk
+//     is reported as an error instead of a crash while writing
+//   - V^2 entries: 100k vertices need 10 GB with 8-bit entries
+//***************************************************************
+
+#ifndef ALL_PAIRS_DISTANCES_H
+#define ALL_PAIRS_DISTANCES_H
+
+#include "IGraph.h"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <functional>
+using namespace std;
+
+const uint32_t DISTANCE_MATRIX_VERSION = 1;
+
+// Header flag bits
+const uint32_t DISTANCE_MATRIX_FLAG_DIRECTED = 1u << 0;
+
+// Struct: DistanceMatrixHeader
+// Purpose:
+//   Fixed 64-byte header at the start of every distance matrix file.
+// Notes:
+//   - byteOrder holds 0x01020304 as written by the producing host;
+//     files from a host with the other byte order are rejected
+//   - complete is set only after every row was written, so a file
+//     left behind by an interrupted run is rejected
+struct DistanceMatrixHeader {
+    char magic[8];              // "GRAPHAPD"
+    uint32_t version;
+    uint32_t flags;
+    int64_t vertexCount;
+    uint32_t entryBytes;        // 1 or 2
+    uint32_t complete;          // 1 once all rows are written
+    uint64_t rowsPosition;      // byte position of row 0
+    uint32_t byteOrder;
+    uint32_t reserved[5];
+};
+
+static_assert(sizeof(DistanceMatrixHeader) == 64, "DistanceMatrixHeader must be 64 bytes");
+
+// Struct: AllPairsProgress
+// Purpose:
+//   Snapshot passed to the progress callback.
+struct AllPairsProgress {
+    long long sourcesDone = 0;
+    long long sourcesTotal = 0;
+    double elapsedSeconds = 0;
+    double sourcesPerSecond = 0;
+    double remainingSeconds = 0;    // estimate at the current rate
+};
+
+// Struct: AllPairsOptions
+// Purpose:
+//   Entry width, threads and progress reporting of the APSP engine.
+struct AllPairsOptions {
+    int entryBytes = 1;                 // 1 (uint8) or 2 (uint16)
+    int threads = 0;                    // 0 = hardware thread count
+    double progressInterval = 1.0;      // seconds between progress calls
+    function<void(const AllPairsProgress&)> progress;   // optional
+};
+
+// Struct: AllPairsStats
+// Purpose:
+//   Summary of one computeAllPairsDistances run.
+struct AllPairsStats {
+    long long sources = 0;
+    long long reachedPairs = 0;     // (s, t) pairs with a path, s = t included
+    long long saturatedPairs = 0;   // reached pairs stored as the limit
+    double seconds = 0;
+    double sourcesPerSecond = 0;
+    long long bytesWritten = 0;     // size of the matrix rows
+};
+
+// Function: computeAllPairsDistances
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// const string& filename - output matrix file (replaced)
+// const AllPairsOptions& options - entry width, threads, progress
+// AllPairsStats* stats - optional run summary (may be nullptr)
+// string* error - optional failure reason (may be nullptr)
+// Output:
+// Returns true if the complete matrix was written
+// Notes:
+// - Directed graphs: row s holds distances along out-edges from s
+// - The progress callback runs on a worker thread, never on two
+//   threads at once, and once more when all sources are done
+bool computeAllPairsDistances(const IGraph& graph,
+                              const string& filename,
+                              const AllPairsOptions& options = AllPairsOptions(),
+                              AllPairsStats* stats = nullptr,
+                              string* error = nullptr);
+
+// Function: printAllPairsProgress
+// Parameters:
+// const AllPairsProgress& progress - snapshot to print
+// Output:
+// Prints one progress line (done / total, rate, time left) to stdout
+// Notes:
+// - Ready-made AllPairsOptions::progress callback for tools
+void printAllPairsProgress(const AllPairsProgress& progress);
+
+// Class: DistanceMatrix
+// Purpose:
+//   Read-only view of a matrix file written by
+//   computeAllPairsDistances, served straight from a file mapping.
+class DistanceMatrix {
+private:
+    void* mapping = nullptr;
+    size_t mappingLength = 0;
+    const unsigned char* rows = nullptr;
+    int V = 0;
+    int entryBytes = 0;
+    bool directed = false;
+
+    // Function: close
+    // Parameters:
+    // None
+    // Output:
+    // Unmaps the current file (if any) and resets the view
+    void close();
+
+public:
+    // Function: DistanceMatrix (Constructor)
+    // Parameters:
+    // None
+    // Output:
+    // Creates an empty view (0 vertices)
+    DistanceMatrix() = default;
+
+    // Function: ~DistanceMatrix (Destructor)
+    // Parameters:
+    // None
+    // Output:
+    // Unmaps the file
+    ~DistanceMatrix();
+
+    DistanceMatrix(const DistanceMatrix&) = delete;
+    DistanceMatrix& operator=(const DistanceMatrix&) = delete;
+
+    // Function: open
+    // Parameters:
+    // const string& filename - matrix file
+    // string* error - optional failure reason (may be nullptr)
+    // Output:
+    // Maps the file read-only; returns false (view left empty) if it
+    // is missing, truncated, incomplete or not a matrix file
+    bool open(const string& filename, string* error = nullptr);
+
+    // Function: getVertexCount / getEntryBytes / isDirected
+    // Parameters:
+    // None
+    // Output:
+    // Returns the matrix dimensions and how it was computed
+    int getVertexCount() const;
+    int getEntryBytes() const;
+    bool isDirected() const;
+
+    // Function: saturationLimit
+    // Parameters:
+    // None
+    // Output:
+    // Returns the largest value distance() reports (254 or 65534);
+    // that value means "at least this far"
+    int saturationLimit() const;
+
+    // Function: distance
+    // Parameters:
+    // int s - source vertex
+    // int t - target vertex
+    // Output:
+    // Returns the hop distance s -> t, saturationLimit() if it is at
+    // least that, or -1 if t is unreachable or either ID is invalid
+    int distance(int s, int t) const;
+};
+
+#endif
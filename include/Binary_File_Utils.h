@@ -0,0 +1,59 @@
+//***************************************************************
+// File: Binary_File_Utils.h
+// Description:
+//   Pieces shared by the on-disk formats: binary graph files
+//   (Graph_Binary_Format), landmark oracle files
+//   (Landmark_Distance_Oracle) and distance matrices
+//   (All_Pairs_Distances).
+//
+// Notes:
+//   - Header-only; used by the format implementations, not by
+//     callers of the formats
+//   - Every format stores BYTE_ORDER_MARK as written by its host, so
+//     files from a host with the other byte order are detected
+//   - Checksums are 64-bit FNV-1a
+//***************************************************************
+
+#ifndef BINARY_FILE_UTILS_H
+#define BINARY_FILE_UTILS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+using namespace std;
+
+const uint32_t BYTE_ORDER_MARK = 0x01020304u;
+
+const uint64_t FNV_OFFSET_BASIS = 1469598103934665603ull;
+const uint64_t FNV_PRIME = 1099511628211ull;
+
+// Function: updateChecksum
+// Parameters:
+// uint64_t hash - running FNV-1a hash (start with FNV_OFFSET_BASIS)
+// const void* data - bytes to add
+// size_t bytes - number of bytes
+// Output:
+// Returns the hash after consuming data
+inline uint64_t updateChecksum(uint64_t hash, const void* data, size_t bytes) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < bytes; i++) {
+        hash ^= p[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+// Function: fail
+// Parameters:
+// string* error - optional message output
+// const string& message - failure reason
+// Output:
+// Stores message (if requested) and returns Result() (false for
+// bool, nullptr for a pointer)
+template <typename Result = bool>
+Result fail(string* error, const string& message) {
+    if (error) *error = message;
+    return Result();
+}
+
+#endif
@@ -0,0 +1,402 @@
+//***************************************************************
+// File: CSR_Implementation_Graph.h
+// Description:
+//   Compressed Sparse Row (CSR) graph implementation that conforms
+//   to IGraph. All neighbor lists are packed into one contiguous
+//   targets array, indexed by an offsets array of size V + 1.
+//
+// Notes:
+//   - Immutable: built once from an edge list or by freezing a
+//     ListGraph; addEdge always returns false
+//   - Neighbors of u are targets[offsets[u] .. offsets[u + 1])
+//   - Best for large, read-mostly sparse graphs
+//   - The arrays are either built vectors or an external read-only
+//     block (e.g. a memory-mapped file), kept alive by a shared
+//     handle; copies of a graph share its arrays
+//   - Weighted graphs keep a weights array parallel to targets;
+//     external (mapped) graphs may map one from the file as well
+//***************************************************************
+
+#ifndef CSR_IMPLEMENTATION_GRAPH_H
+#define CSR_IMPLEMENTATION_GRAPH_H
+
+#include "IGraph.h"
+#include "List_Implementation_Graph.h"
+#include "Lazy_Cache.h"
+#include <vector>
+#include <utility>
+#include <memory>
+#include <iostream>
+using namespace std;
+
+class CSRGraph final : public IGraph {
+private:
+    int V;
+    bool directed;
+
+    // Views used by every accessor; point into sharedStorage
+    const long long* rowOffsets; // size V + 1
+    const int* rowTargets;       // size entryCount
+    const EdgeWeight* rowWeights; // size entryCount, nullptr if unweighted
+    long long entryCount;
+
+    vector<long long> offsets;   // build buffers, moved into sharedStorage
+    vector<int> targets;
+    vector<EdgeWeight> weights;  // empty unless weighted
+    bool weighted;
+    shared_ptr<const void> sharedStorage; // built arrays or an external block
+
+    // In-degrees; precomputed when building, derived on first use
+    // for external storage so opening a file stays O(1)
+    LazyCache<vector<int>> inDegree;
+
+    // Transpose in CSR form: the sources of the edges into v are
+    // sources[offsets[v] .. offsets[v + 1])
+    struct ReverseRows {
+        vector<long long> offsets;
+        vector<int> sources;
+    };
+
+    // Lazily built reverse CSR (directed graphs only)
+    LazyCache<ReverseRows> reverseRows;
+
+    // Function: ensureInDegree
+    // Parameters:
+    // None
+    // Output:
+    // Returns the in-degrees, counting them on first use (directed
+    // graphs only)
+    // Notes:
+    // - Safe to call from several threads at once
+    const vector<int>& ensureInDegree() const;
+
+    // Function: bindOwnedStorage
+    // Parameters:
+    // None
+    // Output:
+    // Moves the owned vectors into sharedStorage and points the row
+    // views at them
+    void bindOwnedStorage();
+
+    // Function: ensureReverseAdjacency
+    // Parameters:
+    // None
+    // Output:
+    // Returns the reverse CSR, building it on first use
+    // Notes:
+    // - Safe to call from several threads at once
+    const ReverseRows& ensureReverseAdjacency() const;
+
+    // Function: isValidVertex
+    // Parameters:
+    // int v - vertex index
+    // Output:
+    // Returns true if v is within [0, V-1]
+    bool isValidVertex(int v) const {
+        return v >= 0 && v < V;
+    }
+
+    // Function: buildFromEdges
+    // Parameters:
+    // const vector<pair<int, int>>& edges - edge list (u, v)
+    // const vector<EdgeWeight>* edgeWeights - weight per edge, or nullptr
+    // Output:
+    // Fills offsets/targets (and weights) with a counting sort over
+    // source vertices
+    void buildFromEdges(const vector<pair<int, int>>& edges, const vector<EdgeWeight>* edgeWeights);
+
+public:
+    // Function: CSRGraph (Constructor)
+    // Parameters:
+    // int vertices - number of vertices
+    // bool isDirected - true for directed graphs
+    // const vector<pair<int, int>>& edges - edge list (u, v)
+    // Output:
+    // Builds the packed graph from an edge list
+    // Notes:
+    // - Edges with out-of-range endpoints are skipped
+    // - Neighbor order matches ListGraph built with the same edges
+    CSRGraph(int vertices, bool isDirected, const vector<pair<int, int>>& edges);
+
+    // Function: CSRGraph (Constructor)
+    // Parameters:
+    // int vertices - number of vertices
+    // bool isDirected - true for directed graphs
+    // const vector<pair<int, int>>& edges - edge list (u, v)
+    // const vector<EdgeWeight>& edgeWeights - edgeWeights[i] weighs edges[i]
+    // Output:
+    // Builds a weighted packed graph from an edge list
+    // Notes:
+    // - Edges with out-of-range endpoints or a negative weight are
+    //   skipped; edges past the end of edgeWeights get weight 1
+    CSRGraph(int vertices,
+             bool isDirected,
+             const vector<pair<int, int>>& edges,
+             const vector<EdgeWeight>& edgeWeights);
+
+    // Function: CSRGraph (Constructor)
+    // Parameters:
+    // const ListGraph& graph - adjacency list graph to freeze
+    // Output:
+    // Builds a packed copy of graph with identical neighbor order
+    // (and its weights, if it is weighted)
+    explicit CSRGraph(const ListGraph& graph);
+
+    // Function: CSRGraph (Constructor)
+    // Parameters:
+    // int vertices - number of vertices
+    // bool isDirected - true for directed graphs
+    // vector<long long>&& rowOffsets - offsets array (size V + 1)
+    // vector<int>&& rowTargets - packed targets array
+    // vector<int>&& inDegrees - in-degree of every vertex
+    // Output:
+    // Adopts already packed arrays without copying
+    // Notes:
+    // - Used by the bulk builder; arrays must be consistent
+    // - An empty inDegrees is allowed and is then derived lazily
+    CSRGraph(int vertices,
+             bool isDirected,
+             vector<long long>&& packedOffsets,
+             vector<int>&& packedTargets,
+             vector<int>&& inDegrees);
+
+    // Function: CSRGraph (Constructor)
+    // Parameters:
+    // int vertices - number of vertices
+    // bool isDirected - true for directed graphs
+    // vector<long long>&& packedOffsets - offsets array (size V + 1)
+    // vector<int>&& packedTargets - packed targets array
+    // vector<EdgeWeight>&& packedWeights - weight of every target entry
+    // vector<int>&& inDegrees - in-degree of every vertex (may be empty)
+    // Output:
+    // Adopts already packed weighted arrays without copying
+    CSRGraph(int vertices,
+             bool isDirected,
+             vector<long long>&& packedOffsets,
+             vector<int>&& packedTargets,
+             vector<EdgeWeight>&& packedWeights,
+             vector<int>&& inDegrees);
+
+    // Function: CSRGraph (Constructor)
+    // Parameters:
+    // int vertices - number of vertices
+    // bool isDirected - true for directed graphs
+    // const long long* offsetData - external offsets array (size V + 1)
+    // const int* targetData - external targets array
+    // shared_ptr<const void> storage - keeps the arrays alive
+    // const EdgeWeight* weightData - external weights parallel to the
+    //                                targets, or nullptr if unweighted
+    // Output:
+    // Serves the external arrays in place (zero-copy)
+    // Notes:
+    // - Used by the binary loader to wrap a memory-mapped file
+    // - Runs in O(1); the arrays are trusted, not validated
+    CSRGraph(int vertices,
+             bool isDirected,
+             const long long* offsetData,
+             const int* targetData,
+             shared_ptr<const void> storage,
+             const EdgeWeight* weightData = nullptr);
+
+    // Function: addEdge
+    // Parameters:
+    // int u - source vertex
+    // int v - destination vertex
+    // Output:
+    // Always returns false (CSR graphs are immutable)
+    bool addEdge(int u, int v) override;
+
+    // Function: isWeighted
+    // Parameters:
+    // None
+    // Output:
+    // Returns true if the graph was built with edge weights
+    bool isWeighted() const override;
+
+    // Function: display
+    // Parameters:
+    // None
+    // Output:
+    // Prints the adjacency lists to standard output
+    void display() const override;
+
+    // Function: getVertexCount
+    // Parameters:
+    // None
+    // Output:
+    // Returns the number of vertices in the graph
+    int getVertexCount() const override;
+
+    // Function: isDirected
+    // Parameters:
+    // None
+    // Output:
+    // Returns true if graph is directed
+    bool isDirected() const override;
+
+    // Function: getNeighbors
+    // Parameters:
+    // int u - vertex to query
+    // Output:
+    // Returns a vector of neighbors of u (empty if u invalid)
+    vector<int> getNeighbors(int u) const override;
+
+    // Function: forEachNeighbor
+    // Parameters:
+    // int u - vertex to query
+    // NeighborVisitor visit - callback receiving each neighbor
+    // Output:
+    // Calls visit(v) for every neighbor v of u without copying
+    void forEachNeighbor(int u, NeighborVisitor visit) const override;
+
+    // Function: forEachNeighbor (inline template)
+    // Parameters:
+    // int u - vertex to query
+    // F&& visit - callable taking a neighbor (may return bool to stop)
+    // Output:
+    // Same as the virtual version, but resolved at compile time so the
+    // callback can be inlined (used by the static algorithm layer)
+    template <typename F>
+    void forEachNeighbor(int u, F&& visit) const {
+        if (!isValidVertex(u)) return;
+
+        const int* first = rowTargets + rowOffsets[u];
+        const int* last = rowTargets + rowOffsets[u + 1];
+        for (const int* p = first; p != last; ++p) {
+            if (!callNeighborVisitor(visit, *p)) return;
+        }
+    }
+
+    // Function: forEachWeightedNeighbor
+    // Parameters:
+    // int u - vertex to query
+    // WeightedNeighborVisitor visit - callback receiving (neighbor, weight)
+    // Output:
+    // Calls visit(v, w) for every entry of row u, in forEachNeighbor order
+    void forEachWeightedNeighbor(int u, WeightedNeighborVisitor visit) const override;
+
+    // Function: forEachWeightedNeighbor (inline template)
+    // Parameters:
+    // int u - vertex to query
+    // F&& visit - callable taking (neighbor, weight) (may return bool to stop)
+    // Output:
+    // Same as the virtual version, resolved at compile time
+    template <typename F>
+    void forEachWeightedNeighbor(int u, F&& visit) const {
+        if (!isValidVertex(u)) return;
+
+        long long first = rowOffsets[u];
+        long long last = rowOffsets[u + 1];
+        if (!rowWeights) {
+            for (long long k = first; k < last; k++) {
+                if (!callWeightedNeighborVisitor(visit, rowTargets[k], 1)) return;
+            }
+            return;
+        }
+
+        for (long long k = first; k < last; k++) {
+            if (!callWeightedNeighborVisitor(visit, rowTargets[k], rowWeights[k])) return;
+        }
+    }
+
+    // Function: forEachInNeighbor
+    // Parameters:
+    // int u - vertex to query
+    // NeighborVisitor visit - callback receiving each in-neighbor
+    // Output:
+    // Calls visit(w) for every edge w -> u
+    // Notes:
+    // - Directed graphs build a reverse CSR on first call
+    void forEachInNeighbor(int u, NeighborVisitor visit) const override;
+
+    // Function: forEachInNeighbor (inline template)
+    // Parameters:
+    // int u - vertex to query
+    // F&& visit - callable taking an in-neighbor (may return bool to stop)
+    // Output:
+    // Same as the virtual version, resolved at compile time
+    template <typename F>
+    void forEachInNeighbor(int u, F&& visit) const {
+        if (!isValidVertex(u)) return;
+
+        if (!directed) {
+            forEachNeighbor(u, visit);
+            return;
+        }
+
+        const ReverseRows& rows = ensureReverseAdjacency();
+        const int* first = rows.sources.data() + rows.offsets[u];
+        const int* last = rows.sources.data() + rows.offsets[u + 1];
+        for (const int* p = first; p != last; ++p) {
+            if (!callNeighborVisitor(visit, *p)) return;
+        }
+    }
+
+    // Function: neighborCursor / inNeighborCursor
+    // Parameters:
+    // int u - vertex to query
+    // Output:
+    // Returns a cursor over u's slice of the targets (or reverse) array
+    // Notes:
+    // - Inline so static-dispatch callers step without a virtual call
+    NeighborCursor neighborCursor(int u) const override {
+        NeighborCursor cursor;
+        cursor.vertex = u;
+        if (isValidVertex(u)) {
+            cursor.position = rowOffsets[u];
+            cursor.end = rowOffsets[u + 1];
+        }
+        return cursor;
+    }
+
+    NeighborCursor inNeighborCursor(int u) const override {
+        if (!directed || !isValidVertex(u)) return neighborCursor(u);
+
+        const ReverseRows& rows = ensureReverseAdjacency();
+        NeighborCursor cursor;
+        cursor.vertex = u;
+        cursor.incoming = true;
+        cursor.position = rows.offsets[u];
+        cursor.end = rows.offsets[u + 1];
+        return cursor;
+    }
+
+    // Function: nextNeighbor
+    // Parameters:
+    // NeighborCursor& cursor - cursor from neighborCursor / inNeighborCursor
+    // int& v - receives the next neighbor
+    // Output:
+    // Returns false once the row is exhausted, O(1)
+    bool nextNeighbor(NeighborCursor& cursor, int& v) const override {
+        if (cursor.position >= cursor.end) return false;
+
+        v = cursor.incoming ? reverseRows.value().sources[cursor.position] : rowTargets[cursor.position];
+        cursor.position++;
+        return true;
+    }
+
+    // Function: getOutDegree
+    // Parameters:
+    // int v - vertex to query
+    // Output:
+    // Returns out-degree of v (0 if invalid), O(1)
+    int getOutDegree(int v) const override;
+
+    // Function: getInDegree
+    // Parameters:
+    // int v - vertex to query
+    // Output:
+    // Returns in-degree of v (0 if invalid), O(1) after the first call
+    int getInDegree(int v) const override;
+
+    // Function: getEdgeEntryCount
+    // Parameters:
+    // None
+    // Output:
+    // Returns the number of stored adjacency entries (size of targets)
+    // Notes:
+    // - Undirected edges are stored twice (once per endpoint)
+    long long getEdgeEntryCount() const;
+};
+
+#endif
@@ -0,0 +1,345 @@
+//***************************************************************
+// File: Compressed_Implementation_Graph.h
+// Description:
+//   Compressed adjacency graph that conforms to IGraph. Every
+//   neighbor list is sorted, gap-encoded and written with
+//   variable-length integers (WebGraph style). Lists are decoded on
+//   the fly while iterating.
+//
+// Row Encoding (bytes of vertex u):
+//   varint(degree)
+//   varint(zigzag(v0 - u))        first neighbor, relative to u
+//   varint(v[i] - v[i-1])         remaining gaps (>= 0, sorted row)
+//
+// Weight Stream (weighted graphs only):
+//   varint(w[i]) for every neighbor of u, in row order, in a separate
+//   buffer starting at weightStart[u]; unweighted scans never read it
+//
+// Notes:
+//   - Immutable: built by compressing another graph; addEdge always
+//     returns false
+//   - A per-vertex byte offset index gives O(1) access to any row
+//   - Neighbors are reported in ascending order, whatever the order
+//     of the source graph
+//   - Graphs with locality (web crawls, social graphs) take about
+//     2-4 bytes per edge; random graphs take more
+//***************************************************************
+
+#ifndef COMPRESSED_IMPLEMENTATION_GRAPH_H
+#define COMPRESSED_IMPLEMENTATION_GRAPH_H
+
+#include "IGraph.h"
+#include "Lazy_Cache.h"
+#include <vector>
+#include <cstdint>
+#include <iostream>
+using namespace std;
+
+// Function: readVarint
+// Parameters:
+// const uint8_t*& p - cursor, advanced past the value
+// Output:
+// Returns the decoded unsigned value (7 bits per byte, LSB first)
+inline uint64_t readVarint(const uint8_t*& p) {
+    uint64_t x = *p++;
+    if (x < 0x80) return x;
+
+    x &= 0x7f;
+    int shift = 7;
+    while (true) {
+        uint64_t b = *p++;
+        x |= (b & 0x7f) << shift;
+        if (b < 0x80) return x;
+        shift += 7;
+    }
+}
+
+class CompressedGraph final : public IGraph {
+private:
+    int V;
+    bool directed;
+    bool weighted;
+    vector<long long> rowStart;      // size V + 1, byte offsets into data
+    vector<uint8_t> data;            // encoded rows
+    vector<long long> weightStart;   // size V + 1 if weighted, byte offsets into weightData
+    vector<uint8_t> weightData;      // encoded weights, empty unless weighted
+    long long entryCount;
+
+    // Encoded transpose: row v lists every u with an edge u -> v
+    struct ReverseRows {
+        vector<long long> rowStart;
+        vector<uint8_t> data;
+    };
+
+    // Lazily built reverse rows (directed graphs only), same encoding
+    LazyCache<ReverseRows> reverseRows;
+
+    // Function: ensureReverseAdjacency
+    // Parameters:
+    // None
+    // Output:
+    // Returns the encoded reverse rows, building them on first use
+    // Notes:
+    // - Safe to call from several threads at once
+    const ReverseRows& ensureReverseAdjacency() const;
+
+    // Function: isValidVertex
+    // Parameters:
+    // int v - vertex index
+    // Output:
+    // Returns true if v is within [0, V-1]
+    bool isValidVertex(int v) const {
+        return v >= 0 && v < V;
+    }
+
+    // Function: decodeRow
+    // Parameters:
+    // const uint8_t* p - first byte of the row
+    // int u - owner of the row
+    // F& visit - callable taking a neighbor (may return bool to stop)
+    // Output:
+    // Decodes the row and reports every neighbor in ascending order
+    template <typename F>
+    static void decodeRow(const uint8_t* p, int u, F& visit) {
+        uint64_t degree = readVarint(p);
+        if (degree == 0) return;
+
+        uint64_t zz = readVarint(p);
+        long long v = (long long)u + (long long)((zz >> 1) ^ (~(zz & 1) + 1));
+        if (!callNeighborVisitor(visit, (int)v)) return;
+
+        for (uint64_t i = 1; i < degree; i++) {
+            v += (long long)readVarint(p);
+            if (!callNeighborVisitor(visit, (int)v)) return;
+        }
+    }
+
+    // Function: openRow
+    // Parameters:
+    // const uint8_t* base - encoded rows (forward or reverse)
+    // long long start - byte offset of the row
+    // NeighborCursor& cursor - cursor to position (vertex already set)
+    // Output:
+    // Reads the degree and decodes the first neighbor into the cursor
+    static void openRow(const uint8_t* base, long long start, NeighborCursor& cursor) {
+        const uint8_t* p = base + start;
+        cursor.end = (long long)readVarint(p);
+        if (cursor.end > 0) {
+            uint64_t zz = readVarint(p);
+            cursor.next = (long long)cursor.vertex + (long long)((zz >> 1) ^ (~(zz & 1) + 1));
+        }
+        cursor.position = p - base;
+    }
+
+public:
+    // Function: CompressedGraph (Constructor)
+    // Parameters:
+    // const IGraph& graph - graph to compress (any representation)
+    // Output:
+    // Encodes every neighbor list of graph
+    // Notes:
+    // - Only one row is held uncompressed at a time, so a memory
+    //   mapped binary graph can be compressed without loading it
+    // - Weights of a weighted graph are kept in the weight stream
+    explicit CompressedGraph(const IGraph& graph);
+
+    // Function: addEdge
+    // Parameters:
+    // int u - source vertex
+    // int v - destination vertex
+    // Output:
+    // Always returns false (compressed graphs are immutable)
+    bool addEdge(int u, int v) override;
+
+    // Function: display
+    // Parameters:
+    // None
+    // Output:
+    // Prints the adjacency lists to standard output
+    void display() const override;
+
+    // Function: getVertexCount
+    // Parameters:
+    // None
+    // Output:
+    // Returns the number of vertices in the graph
+    int getVertexCount() const override;
+
+    // Function: isDirected
+    // Parameters:
+    // None
+    // Output:
+    // Returns true if graph is directed
+    bool isDirected() const override;
+
+    // Function: isWeighted
+    // Parameters:
+    // None
+    // Output:
+    // Returns true if the compressed graph was weighted
+    bool isWeighted() const override;
+
+    // Function: getNeighbors
+    // Parameters:
+    // int u - vertex to query
+    // Output:
+    // Returns the decoded neighbors of u (empty if u invalid)
+    vector<int> getNeighbors(int u) const override;
+
+    // Function: forEachNeighbor
+    // Parameters:
+    // int u - vertex to query
+    // NeighborVisitor visit - callback receiving each neighbor
+    // Output:
+    // Decodes row u and calls visit(v) for every neighbor
+    void forEachNeighbor(int u, NeighborVisitor visit) const override;
+
+    // Function: forEachNeighbor (inline template)
+    // Parameters:
+    // int u - vertex to query
+    // F&& visit - callable taking a neighbor (may return bool to stop)
+    // Output:
+    // Same as the virtual version, resolved at compile time
+    template <typename F>
+    void forEachNeighbor(int u, F&& visit) const {
+        if (!isValidVertex(u)) return;
+        decodeRow(data.data() + rowStart[u], u, visit);
+    }
+
+    // Function: forEachWeightedNeighbor
+    // Parameters:
+    // int u - vertex to query
+    // WeightedNeighborVisitor visit - callback receiving (neighbor, weight)
+    // Output:
+    // Calls visit(v, weight) for every neighbor v of u (weight 1 if unweighted)
+    void forEachWeightedNeighbor(int u, WeightedNeighborVisitor visit) const override;
+
+    // Function: forEachWeightedNeighbor (inline template)
+    // Parameters:
+    // int u - vertex to query
+    // F&& visit - callable taking (neighbor, weight) (may return bool to stop)
+    // Output:
+    // Same as the virtual version, resolved at compile time
+    template <typename F>
+    void forEachWeightedNeighbor(int u, F&& visit) const {
+        if (!weighted) {
+            forEachNeighbor(u, [&](int v) {
+                return callWeightedNeighborVisitor(visit, v, 1);
+            });
+            return;
+        }
+
+        if (!isValidVertex(u)) return;
+        const uint8_t* w = weightData.data() + weightStart[u];
+        forEachNeighbor(u, [&](int v) {
+            return callWeightedNeighborVisitor(visit, v, (EdgeWeight)readVarint(w));
+        });
+    }
+
+    // Function: forEachInNeighbor
+    // Parameters:
+    // int u - vertex to query
+    // NeighborVisitor visit - callback receiving each in-neighbor
+    // Output:
+    // Calls visit(w) for every edge w -> u
+    // Notes:
+    // - Directed graphs encode the reverse rows on first call
+    void forEachInNeighbor(int u, NeighborVisitor visit) const override;
+
+    // Function: forEachInNeighbor (inline template)
+    // Parameters:
+    // int u - vertex to query
+    // F&& visit - callable taking an in-neighbor (may return bool to stop)
+    // Output:
+    // Same as the virtual version, resolved at compile time
+    template <typename F>
+    void forEachInNeighbor(int u, F&& visit) const {
+        if (!isValidVertex(u)) return;
+
+        if (!directed) {
+            forEachNeighbor(u, visit);
+            return;
+        }
+
+        const ReverseRows& rows = ensureReverseAdjacency();
+        decodeRow(rows.data.data() + rows.rowStart[u], u, visit);
+    }
+
+    // Function: neighborCursor / inNeighborCursor
+    // Parameters:
+    // int u - vertex to query
+    // Output:
+    // Returns a cursor over u's encoded row
+    // Notes:
+    // - position is the byte offset of the next gap, end the number of
+    //   neighbors left and next the already decoded next neighbor
+    NeighborCursor neighborCursor(int u) const override {
+        NeighborCursor cursor;
+        cursor.vertex = u;
+        if (isValidVertex(u)) openRow(data.data(), rowStart[u], cursor);
+        return cursor;
+    }
+
+    NeighborCursor inNeighborCursor(int u) const override {
+        if (!directed || !isValidVertex(u)) return neighborCursor(u);
+
+        const ReverseRows& rows = ensureReverseAdjacency();
+        NeighborCursor cursor;
+        cursor.vertex = u;
+        cursor.incoming = true;
+        openRow(rows.data.data(), rows.rowStart[u], cursor);
+        return cursor;
+    }
+
+    // Function: nextNeighbor
+    // Parameters:
+    // NeighborCursor& cursor - cursor from neighborCursor / inNeighborCursor
+    // int& v - receives the next neighbor
+    // Output:
+    // Returns false once the row is exhausted; decodes one gap per call
+    bool nextNeighbor(NeighborCursor& cursor, int& v) const override {
+        if (cursor.end == 0) return false;
+
+        v = (int)cursor.next;
+        if (--cursor.end > 0) {
+            const uint8_t* base = cursor.incoming ? reverseRows.value().data.data() : data.data();
+            const uint8_t* p = base + cursor.position;
+            cursor.next += (long long)readVarint(p);
+            cursor.position = p - base;
+        }
+        return true;
+    }
+
+    // Function: getOutDegree
+    // Parameters:
+    // int v - vertex to query
+    // Output:
+    // Returns out-degree of v (0 if invalid), read from the row header
+    int getOutDegree(int v) const override;
+
+    // Function: getInDegree
+    // Parameters:
+    // int v - vertex to query
+    // Output:
+    // Returns in-degree of v (0 if invalid)
+    // Notes:
+    // - Directed graphs build the reverse rows on first call
+    int getInDegree(int v) const override;
+
+    // Function: getEdgeEntryCount
+    // Parameters:
+    // None
+    // Output:
+    // Returns the number of stored adjacency entries
+    long long getEdgeEntryCount() const;
+
+    // Function: getEncodedBytes
+    // Parameters:
+    // None
+    // Output:
+    // Returns the size of the encoded rows and weights in bytes
+    // (indexes excluded)
+    long long getEncodedBytes() const;
+};
+
+#endif
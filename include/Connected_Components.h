@@ -0,0 +1,85 @@
+//***************************************************************
+// File: Connected_Components.h
+// Description:
+//   Declares a multithreaded connected components decomposition that
+//   returns a label per vertex, the size of every component and the
+//   largest one.
+//
+// Afforest summary (Sutton et al., "Optimizing Parallel Graph
+// Connectivity Computation via Subgraph Sampling"):
+//   1) Sampling: every vertex is united with its first few neighbors
+//      only, which already merges most of a small-world graph
+//   2) The most frequent set among a random sample of vertices is
+//      taken to be the giant component
+//   3) Finish: every vertex outside the giant component unites with
+//      the rest of its neighbors
+//   All unions go through a lock-free ConcurrentUnionFind
+//   (Union_Find.h), and every step is split across the workers.
+//
+// Notes:
+//   - Directed graphs are decomposed into weakly connected components.
+//     Only out-edges are read (no reverse adjacency is built): a union
+//     is symmetric, so every edge counts once, from its tail. Vertices
+//     of the giant component are then not skipped in step 3, since
+//     some edges may only be seen from them
+//   - componentId values are 0..count-1, numbered in increasing order
+//     of each component's smallest vertex, so the result is the same
+//     for any thread count and run
+//***************************************************************
+
+#ifndef CONNECTED_COMPONENTS_H
+#define CONNECTED_COMPONENTS_H
+
+#include "IGraph.h"
+#include <vector>
+using namespace std;
+
+// Struct: ConnectedComponentsOptions
+// Purpose:
+//   Tuning knobs of findConnectedComponents.
+struct ConnectedComponentsOptions {
+    int threads = 0;                 // 0 = hardware thread count
+    int samplingRounds = 2;          // neighbors per vertex united in step 1
+    int sampleSize = 1024;           // vertices drawn to find the giant component
+    int minParallelVertices = 4096;  // smaller graphs run on one thread
+};
+
+// Struct: ConnectedComponents
+// Purpose:
+//   Result of a connected components decomposition.
+struct ConnectedComponents {
+    vector<int> componentId;         // componentId[v] = component of v
+    vector<int> componentSize;       // componentSize[c] = vertices in c
+    int largest = -1;                // largest component (smallest ID on ties), -1 if none
+
+    // Function: count
+    // Parameters:
+    // None
+    // Output:
+    // Returns the number of components
+    int count() const { return (int)componentSize.size(); }
+};
+
+// Function: findConnectedComponents
+// Parameters:
+// const IGraph& graph - reference to a graph implementing IGraph
+// const ConnectedComponentsOptions& options - thread count and tuning
+// Output:
+// Returns the labels, sizes and largest component of graph
+// Notes:
+// - Weakly connected components for directed graphs
+ConnectedComponents findConnectedComponents(const IGraph& graph,
+                                            const ConnectedComponentsOptions& options = ConnectedComponentsOptions());
+
+// Function: countConnectedComponents
+// Parameters:
+// const IGraph& graph - reference to a graph implementing IGraph
+// const ConnectedComponentsOptions& options - thread count and tuning
+// Output:
+// Returns the number of connected components (0 for an empty graph)
+// Notes:
+// - Skips building the label and size arrays
+int countConnectedComponents(const IGraph& graph,
+                             const ConnectedComponentsOptions& options = ConnectedComponentsOptions());
+
+#endif
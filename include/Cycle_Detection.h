@@ -6,7 +6,7 @@
 //
 // Notes:
 //   - Undirected: DFS with parent tracking
-//   - Directed: DFS with recursion stack detection
+//   - Directed: DFS with open-vertex (back edge) detection
 //***************************************************************
 
 #ifndef CYCLE_DETECTION_H
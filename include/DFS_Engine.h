@@ -0,0 +1,195 @@
+//***************************************************************
+// File: DFS_Engine.h
+// Description:
+//   Iterative depth-first search core shared by every DFS-based
+//   algorithm in the project (traversal order, cycle detection,
+//   Kosaraju, Euler connectivity).
+//
+//   The engine keeps an explicit stack of NeighborCursor frames, one
+//   per open vertex, so each row is scanned exactly once and the depth
+//   of the search is limited by memory, not by the call stack.
+//
+// Events (members of the visitor, all optional):
+//   - discoverVertex(u, parent)    u entered (parent = -1 for a root)
+//   - examineEdge(u, v)            edge u -> v about to be classified
+//   - backEdge(u, v)               v is open (an ancestor of u, or u)
+//   - forwardOrCrossEdge(u, v)     v is already finished
+//   - finishVertex(u, parent)      every edge out of u examined
+//   Tree edges are reported as discoverVertex(v, u). Each event may
+//   return void, or bool where false stops the search.
+//
+// Example:
+//   struct Preorder : DFSVisitorBase {
+//       vector<int> order;
+//       void discoverVertex(int u, int) { order.push_back(u); }
+//   };
+//   DFSEngine<CSRGraph> dfs(graph);
+//   Preorder visitor;
+//   dfs.run(start, visitor);
+//
+// Notes:
+//   - Visit order equals the recursive DFS over forEachNeighbor
+//   - Undirected graphs report the edge back to the parent as a
+//     backEdge; callers that need it skip v == parentOf(u)
+//***************************************************************
+
+#ifndef DFS_ENGINE_H
+#define DFS_ENGINE_H
+
+#include "IGraph.h"
+#include <vector>
+#include <type_traits>
+using namespace std;
+
+// Struct: DFSVisitorBase
+// Purpose:
+//   No-op defaults for every DFSEngine event; visitors derive from it
+//   and declare only the events they use.
+struct DFSVisitorBase {
+    bool discoverVertex(int, int) { return true; }
+    bool examineEdge(int, int) { return true; }
+    bool backEdge(int, int) { return true; }
+    bool forwardOrCrossEdge(int, int) { return true; }
+    bool finishVertex(int, int) { return true; }
+};
+
+// Function: continueAfterDFSEvent
+// Parameters:
+// F&& event - callable invoking one visitor event
+// Output:
+// Returns false if the event returned false, true otherwise
+// Notes:
+// - Lets events return void or bool, like callNeighborVisitor
+template <typename F>
+inline bool continueAfterDFSEvent(F&& event) {
+    if constexpr (is_void<decltype(event())>::value) {
+        event();
+        return true;
+    } else {
+        return static_cast<bool>(event());
+    }
+}
+
+// Class: DFSEngine
+// Purpose:
+//   Iterative DFS over any graph type providing getVertexCount,
+//   neighborCursor / inNeighborCursor and nextNeighbor.
+// Notes:
+//   - Visited state persists across run() calls, so running from
+//     several roots explores a DFS forest
+//   - After a search stopped by an event, call reset() before reuse
+template <typename G>
+class DFSEngine {
+private:
+    // Vertex states
+    static constexpr unsigned char NEW = 0;
+    static constexpr unsigned char OPEN = 1;
+    static constexpr unsigned char DONE = 2;
+
+    const G& graph;
+    bool incoming;
+    int V;
+    vector<unsigned char> state;
+    vector<int> parent;
+    vector<NeighborCursor> stack;
+
+    // Function: open
+    // Parameters:
+    // int u - vertex to enter
+    // int from - its parent (-1 for a root)
+    // Output:
+    // Marks u open and pushes its cursor
+    void open(int u, int from) {
+        state[u] = OPEN;
+        parent[u] = from;
+        stack.push_back(incoming ? graph.inNeighborCursor(u) : graph.neighborCursor(u));
+    }
+
+public:
+    // Function: DFSEngine (Constructor)
+    // Parameters:
+    // const G& graph - graph to search (must outlive the engine)
+    // bool followIncoming - walk edges backwards (in-neighbors)
+    // Output:
+    // Creates an engine with every vertex unvisited
+    explicit DFSEngine(const G& graph, bool followIncoming = false)
+        : graph(graph),
+          incoming(followIncoming),
+          V(graph.getVertexCount()),
+          state(V, NEW),
+          parent(V, -1) {}
+
+    // Function: run
+    // Parameters:
+    // int root - vertex to start from
+    // Visitor& visitor - event callbacks (see DFSVisitorBase)
+    // Output:
+    // Explores everything reachable from root that is still unvisited;
+    // returns false if an event stopped the search
+    // Notes:
+    // - Does nothing (returns true) if root is invalid or visited
+    template <typename Visitor>
+    bool run(int root, Visitor& visitor) {
+        if (root < 0 || root >= V || state[root] != NEW) return true;
+
+        open(root, -1);
+        if (!continueAfterDFSEvent([&] { return visitor.discoverVertex(root, -1); })) return false;
+
+        while (!stack.empty()) {
+            NeighborCursor& cursor = stack.back();
+            int u = cursor.vertex;
+            int v;
+
+            if (!graph.nextNeighbor(cursor, v)) {
+                stack.pop_back();
+                state[u] = DONE;
+                if (!continueAfterDFSEvent([&] { return visitor.finishVertex(u, parent[u]); })) return false;
+                continue;
+            }
+
+            if (v < 0 || v >= V) continue; // safety guard
+            if (!continueAfterDFSEvent([&] { return visitor.examineEdge(u, v); })) return false;
+
+            if (state[v] == NEW) {
+                open(v, u);
+                if (!continueAfterDFSEvent([&] { return visitor.discoverVertex(v, u); })) return false;
+            } else if (state[v] == OPEN) {
+                if (!continueAfterDFSEvent([&] { return visitor.backEdge(u, v); })) return false;
+            } else {
+                if (!continueAfterDFSEvent([&] { return visitor.forwardOrCrossEdge(u, v); })) return false;
+            }
+        }
+        return true;
+    }
+
+    // Function: isVisited
+    // Parameters:
+    // int v - vertex to query
+    // Output:
+    // Returns true if some run() has discovered v
+    bool isVisited(int v) const {
+        return state[v] != NEW;
+    }
+
+    // Function: parentOf
+    // Parameters:
+    // int v - vertex to query
+    // Output:
+    // Returns the DFS tree parent of v (-1 for roots and unvisited)
+    int parentOf(int v) const {
+        return parent[v];
+    }
+
+    // Function: reset
+    // Parameters:
+    // None
+    // Output:
+    // Marks every vertex unvisited again
+    void reset() {
+        stack.clear();
+        state.assign(V, NEW);
+        parent.assign(V, -1);
+    }
+};
+
+#endif
@@ -0,0 +1,206 @@
+//***************************************************************
+// File: Dynamic_Topological_Order.h
+// Description:
+//   Declares a directed acyclic graph that keeps a topological order
+//   up to date while edges are inserted (Pearce & Kelly, "A Dynamic
+//   Topological Sort Algorithm for Directed Acyclic Graphs").
+//
+// Inserting u -> v:
+//   - If u already comes before v, the order stays as it is
+//   - Otherwise only the affected region, the positions between
+//     position(v) and position(u), is searched:
+//       1) forward from v, through vertices placed before u; reaching
+//          u means the edge would close a cycle, so it is rejected
+//       2) backward from u, through vertices placed after v
+//   - The backward set is moved ahead of the forward set, reusing
+//     exactly the positions the two sets held
+//
+// Example:
+//   DynamicTopologicalOrder dag(3);
+//   dag.addEdge(2, 1);
+//   dag.addEdge(1, 0);
+//   vector<int> cycle;
+//   dag.addEdge(0, 2, &cycle);  // false, cycle = {2, 1, 0}
+//   dag.getOrder();             // {2, 1, 0}
+//
+// Notes:
+//   - The structure keeps its own out / in adjacency, since the search
+//     needs both directions of a graph that keeps changing
+//   - Search marks are stamped per insertion, so an insertion costs
+//     O(region log region) and never a pass over all vertices
+//***************************************************************
+
+#ifndef DYNAMIC_TOPOLOGICAL_ORDER_H
+#define DYNAMIC_TOPOLOGICAL_ORDER_H
+
+#include "IGraph.h"
+#include <vector>
+using namespace std;
+
+// Struct: DynamicTopologicalOrderStats
+// Purpose:
+//   Running counters of a DynamicTopologicalOrder.
+struct DynamicTopologicalOrderStats {
+    long long edgesAdded = 0;       // edges accepted by addEdge
+    long long edgesRejected = 0;    // edges refused because of a cycle
+    long long reorders = 0;         // insertions that moved vertices
+    long long verticesVisited = 0;  // total size of the searched regions
+};
+
+// Class: DynamicTopologicalOrder
+// Purpose:
+//   DAG under edge insertions with a topological order maintained by
+//   the Pearce-Kelly algorithm.
+class DynamicTopologicalOrder {
+private:
+    int V;
+    long long edges;
+    vector<vector<int>> out;
+    vector<vector<int>> in;
+    vector<int> ord;                // ord[v] = position of v
+    vector<int> at;                 // at[p] = vertex at position p
+
+    // Search scratch, reused by every insertion
+    vector<unsigned int> mark;      // == stamp when visited by this insertion
+    unsigned int stamp;
+    vector<int> via;                // forward search: vertex that reached v
+    vector<int> forwardSet;
+    vector<int> backwardSet;
+    vector<int> stack;
+    vector<int> positions;
+
+    DynamicTopologicalOrderStats stats;
+
+    // Function: isValidVertex
+    // Parameters:
+    // int v - vertex index
+    // Output:
+    // Returns true if v is within [0, V-1]
+    bool isValidVertex(int v) const {
+        return v >= 0 && v < V;
+    }
+
+    // Function: reset
+    // Parameters:
+    // int vertices - number of vertices
+    // Output:
+    // Drops every edge and orders the vertices by ID
+    void reset(int vertices);
+
+    // Function: nextStamp
+    // Parameters:
+    // None
+    // Output:
+    // Starts a new search generation (clears the marks on wraparound)
+    void nextStamp();
+
+    // Function: searchForward
+    // Parameters:
+    // int start - head of the new edge
+    // int target - tail of the new edge
+    // Output:
+    // Collects the vertices reachable from start that are placed before
+    // target into forwardSet; returns false if target is reachable
+    bool searchForward(int start, int target);
+
+    // Function: searchBackward
+    // Parameters:
+    // int start - tail of the new edge
+    // int lower - position of the head of the new edge
+    // Output:
+    // Collects the vertices that reach start and are placed after
+    // lower into backwardSet
+    void searchBackward(int start, int lower);
+
+    // Function: reorder
+    // Parameters:
+    // None
+    // Output:
+    // Places backwardSet, then forwardSet, on the positions they hold
+    void reorder();
+
+public:
+    // Function: DynamicTopologicalOrder (Constructor)
+    // Parameters:
+    // int vertices - number of vertices (no edges)
+    // Output:
+    // Creates an edgeless DAG ordered by vertex ID
+    explicit DynamicTopologicalOrder(int vertices = 0);
+
+    // Function: build
+    // Parameters:
+    // const IGraph& graph - directed graph to copy
+    // Output:
+    // Replaces the contents with graph's vertices and edges, ordered by
+    // topologicalSort; returns false (leaving graph's vertices without
+    // edges) if graph is undirected or has a cycle
+    bool build(const IGraph& graph);
+
+    // Function: addVertex
+    // Parameters:
+    // None
+    // Output:
+    // Adds an isolated vertex at the end of the order and returns its ID
+    int addVertex();
+
+    // Function: addEdge
+    // Parameters:
+    // int u - source vertex
+    // int v - destination vertex
+    // vector<int>* cycle - optional: receives the path v ... u that the
+    //                      edge would close (may be nullptr)
+    // Output:
+    // Inserts u -> v and repairs the order; returns false and leaves
+    // the graph unchanged if a vertex is invalid or the edge would
+    // close a cycle
+    // Notes:
+    // - A self-loop is a cycle of one vertex: cycle = {u}
+    // - Parallel edges are accepted
+    bool addEdge(int u, int v, vector<int>* cycle = nullptr);
+
+    // Function: getVertexCount
+    // Parameters:
+    // None
+    // Output:
+    // Returns the number of vertices
+    int getVertexCount() const;
+
+    // Function: getEdgeCount
+    // Parameters:
+    // None
+    // Output:
+    // Returns the number of edges
+    long long getEdgeCount() const;
+
+    // Function: getOrder
+    // Parameters:
+    // None
+    // Output:
+    // Returns the vertices in topological order (every edge goes
+    // forward), without copying
+    const vector<int>& getOrder() const;
+
+    // Function: position
+    // Parameters:
+    // int v - vertex to query
+    // Output:
+    // Returns the index of v in getOrder(), -1 if v is invalid
+    int position(int v) const;
+
+    // Function: getNeighbors
+    // Parameters:
+    // int u - vertex to query
+    // Output:
+    // Returns the out-neighbors of u in insertion order (empty if
+    // invalid), without copying
+    const vector<int>& getNeighbors(int u) const;
+
+    // Function: getStats
+    // Parameters:
+    // None
+    // Output:
+    // Returns the running insertion counters
+    const DynamicTopologicalOrderStats& getStats() const;
+};
+
+#endif
@@ -0,0 +1,106 @@
+//***************************************************************
+// File: Graph_Binary_Format.h
+// Description:
+//   Versioned on-disk binary format for graphs, plus a writer for
+//   any IGraph and a zero-copy loader based on mmap.
+//
+// File Layout (native byte order, all sections 8-byte aligned):
+//   [0, 64)          BinaryGraphHeader
+//   offsetsPosition  int64 offsets[V + 1]
+//   targetsPosition  int32 targets[entryCount]
+//   weightsPosition  int64 weights[entryCount]   (weighted graphs only)
+//
+//   weightsPosition is not stored: it is the end of the targets array
+//   rounded up to 8 bytes (the gap is zero padding)
+//
+// Notes:
+//   - The body is exactly the CSR layout, so a loaded file is served
+//     as a CSRGraph that reads straight from the mapped pages
+//   - Loading is O(1): pages are faulted in on first access and
+//     shared through the page cache by every process mapping the file
+//   - Undirected graphs store both directions of every edge, exactly
+//     as the in-memory representations do
+//   - Version 2 added the weights section; version 1 files (never
+//     weighted) still load
+//***************************************************************
+
+#ifndef GRAPH_BINARY_FORMAT_H
+#define GRAPH_BINARY_FORMAT_H
+
+#include "IGraph.h"
+#include "CSR_Implementation_Graph.h"
+#include <cstdint>
+#include <string>
+using namespace std;
+
+const uint32_t BINARY_GRAPH_VERSION = 2;
+
+// Header flag bits
+const uint32_t BINARY_FLAG_DIRECTED = 1u << 0;
+const uint32_t BINARY_FLAG_CHECKSUM = 1u << 1;
+const uint32_t BINARY_FLAG_WEIGHTED = 1u << 2;
+
+// Struct: BinaryGraphHeader
+// Purpose:
+//   Fixed 64-byte header at the start of every binary graph file.
+// Notes:
+//   - byteOrder holds 0x01020304 as written by the producing host;
+//     files from a host with the other byte order are rejected
+//   - checksum is FNV-1a (64-bit) over the offsets bytes followed by
+//     the targets bytes (then the weights bytes, if any), valid only
+//     with BINARY_FLAG_CHECKSUM
+struct BinaryGraphHeader {
+    char magic[8];              // "GRAPHCSR"
+    uint32_t version;
+    uint32_t flags;
+    int64_t vertexCount;
+    int64_t entryCount;         // number of targets entries
+    uint64_t offsetsPosition;   // byte position of offsets array
+    uint64_t targetsPosition;   // byte position of targets array
+    uint64_t checksum;
+    uint32_t byteOrder;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(BinaryGraphHeader) == 64, "BinaryGraphHeader must be 64 bytes");
+
+// Enum: BinaryLoadMode
+// Purpose:
+//   How much of a file loadBinaryGraph checks before handing it out.
+enum class BinaryLoadMode {
+    Verify,     // checksum and every offset/target/weight, O(V + E)
+    TrustBody   // header and the two ends of the offsets array, O(1)
+};
+
+// Function: writeBinaryGraph
+// Parameters:
+// const IGraph& graph - graph of any representation
+// const string& filename - output file
+// bool withChecksum - store a checksum of the body (default true)
+// Output:
+// Returns true if the whole file was written, false otherwise
+// Notes:
+// - Streams rows through forEachNeighbor; no full copy is made
+// - Weighted graphs also get the weights section, streamed through
+//   forEachWeightedNeighbor
+bool writeBinaryGraph(const IGraph& graph, const string& filename, bool withChecksum = true);
+
+// Function: loadBinaryGraph
+// Parameters:
+// const string& filename - binary graph file
+// BinaryLoadMode mode - Verify (default) or TrustBody
+// string* error - optional message on failure (may be nullptr)
+// Output:
+// Returns a read-only CSRGraph viewing the mapped file, or nullptr
+// Notes:
+// - Verify reads the whole file (O(V + E)), so every later access
+//   stays inside the mapped arrays
+// - TrustBody is only for files known to be intact (e.g. written by
+//   this program): a corrupted body is not detected, and an
+//   out-of-range target then makes reads go out of bounds
+// - The mapping is released when the returned graph is deleted
+CSRGraph* loadBinaryGraph(const string& filename,
+                          BinaryLoadMode mode = BinaryLoadMode::Verify,
+                          string* error = nullptr);
+
+#endif
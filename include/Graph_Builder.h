@@ -0,0 +1,142 @@
+//***************************************************************
+// File: Graph_Builder.h
+// Description:
+//   Bulk graph construction from edge arrays. Instead of one addEdge
+//   call per edge, the builder counts degrees first, sizes every
+//   neighbor list exactly once, and fills them with a parallel
+//   counting sort.
+//
+// Pipeline:
+//   1) Parallel degree count (atomic counters)
+//   2) Prefix sum -> row offsets
+//   3) Parallel scatter of targets into their rows
+//   4) Optional per-row sort / deduplication (parallel over rows)
+//
+// Notes:
+//   - Input may be one edge array or several per-thread buffers, so
+//     producers never have to merge their output first
+//   - Edges with an out-of-range endpoint are skipped and counted
+//   - Weighted overloads take one weight per edge (missing entries
+//     count as 1); negative weights are skipped as invalid, and
+//     deduplication keeps the lightest of the parallel edges
+//   - Returned graphs are allocated with new; caller must delete
+//***************************************************************
+
+#ifndef GRAPH_BUILDER_H
+#define GRAPH_BUILDER_H
+
+#include "IGraph.h"
+#include "List_Implementation_Graph.h"
+#include "CSR_Implementation_Graph.h"
+#include <vector>
+#include <utility>
+using namespace std;
+
+// Struct: GraphBuildOptions
+// Purpose:
+//   Controls how edge arrays are turned into a graph.
+// Notes:
+//   - Without sortNeighbors, row order depends on thread timing
+//   - deduplicate implies sorted rows
+struct GraphBuildOptions {
+    bool directed = false;
+    bool dropSelfLoops = false;
+    bool deduplicate = false;
+    bool sortNeighbors = true;
+    int threads = 0;            // 0 = hardware thread count
+};
+
+// Struct: GraphBuildStats
+// Purpose:
+//   Reports what the builder kept and what it dropped.
+struct GraphBuildStats {
+    long long inputEdges = 0;
+    long long invalidEdges = 0;       // endpoint outside [0, V-1] or weight < 0
+    long long selfLoopsDropped = 0;
+    long long duplicatesRemoved = 0;  // adjacency entries removed
+    long long storedEntries = 0;      // final adjacency entries
+};
+
+// Function: buildCSRGraph
+// Parameters:
+// int vertices - number of vertices
+// const vector<pair<int, int>>& edges - edge array (u, v)
+// const GraphBuildOptions& options - build options
+// GraphBuildStats* stats - optional output statistics (may be nullptr)
+// Output:
+// Returns a new CSRGraph built from edges
+CSRGraph* buildCSRGraph(int vertices,
+                        const vector<pair<int, int>>& edges,
+                        const GraphBuildOptions& options,
+                        GraphBuildStats* stats = nullptr);
+
+// Function: buildCSRGraph
+// Parameters:
+// int vertices - number of vertices
+// const vector<pair<int, int>>& edges - edge array (u, v)
+// const vector<EdgeWeight>& weights - weights[i] is the weight of edges[i]
+// const GraphBuildOptions& options - build options
+// GraphBuildStats* stats - optional output statistics (may be nullptr)
+// Output:
+// Returns a new weighted CSRGraph built from edges
+CSRGraph* buildCSRGraph(int vertices,
+                        const vector<pair<int, int>>& edges,
+                        const vector<EdgeWeight>& weights,
+                        const GraphBuildOptions& options,
+                        GraphBuildStats* stats = nullptr);
+
+// Function: buildCSRGraph
+// Parameters:
+// int vertices - number of vertices
+// const vector<vector<pair<int, int>>>& edgeBuffers - per-thread edge buffers
+// const GraphBuildOptions& options - build options
+// GraphBuildStats* stats - optional output statistics (may be nullptr)
+// Output:
+// Returns a new CSRGraph built from all buffers (no merge copy)
+CSRGraph* buildCSRGraph(int vertices,
+                        const vector<vector<pair<int, int>>>& edgeBuffers,
+                        const GraphBuildOptions& options,
+                        GraphBuildStats* stats = nullptr);
+
+// Function: buildListGraph
+// Parameters:
+// int vertices - number of vertices
+// const vector<pair<int, int>>& edges - edge array (u, v)
+// const GraphBuildOptions& options - build options
+// GraphBuildStats* stats - optional output statistics (may be nullptr)
+// Output:
+// Returns a new ListGraph whose lists are allocated at their exact size
+ListGraph* buildListGraph(int vertices,
+                          const vector<pair<int, int>>& edges,
+                          const GraphBuildOptions& options,
+                          GraphBuildStats* stats = nullptr);
+
+// Function: buildListGraph
+// Parameters:
+// int vertices - number of vertices
+// const vector<pair<int, int>>& edges - edge array (u, v)
+// const vector<EdgeWeight>& weights - weights[i] is the weight of edges[i]
+// const GraphBuildOptions& options - build options
+// GraphBuildStats* stats - optional output statistics (may be nullptr)
+// Output:
+// Returns a new weighted ListGraph built from edges
+ListGraph* buildListGraph(int vertices,
+                          const vector<pair<int, int>>& edges,
+                          const vector<EdgeWeight>& weights,
+                          const GraphBuildOptions& options,
+                          GraphBuildStats* stats = nullptr);
+
+// Function: buildListGraph
+// Parameters:
+// int vertices - number of vertices
+// const vector<vector<pair<int, int>>>& edgeBuffers - per-thread edge buffers
+// const GraphBuildOptions& options - build options
+// GraphBuildStats* stats - optional output statistics (may be nullptr)
+// Output:
+// Returns a new ListGraph built from all buffers
+ListGraph* buildListGraph(int vertices,
+                          const vector<vector<pair<int, int>>>& edgeBuffers,
+                          const GraphBuildOptions& options,
+                          GraphBuildStats* stats = nullptr);
+
+#endif
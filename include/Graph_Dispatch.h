@@ -0,0 +1,43 @@
+//***************************************************************
+// File: Graph_Dispatch.h
+// Description:
+//   Turns a runtime IGraph reference into a call on its concrete
+//   type, so template algorithms can run without per-edge virtual
+//   calls.
+//
+// Example:
+//   int n = dispatchGraph(graph, [&](const auto& g) {
+//       return StaticAlgorithms::bfsOrder(g, 0).size();
+//   });
+//
+// Notes:
+//   - One dynamic_cast chain per algorithm call, not per vertex
+//   - Unknown IGraph types fall back to the IGraph itself, which
+//     still satisfies the graph concept through virtual calls
+//***************************************************************
+
+#ifndef GRAPH_DISPATCH_H
+#define GRAPH_DISPATCH_H
+
+#include "IGraph.h"
+#include "List_Implementation_Graph.h"
+#include "Matrix_Implementation_Graph.h"
+#include "CSR_Implementation_Graph.h"
+#include "Compressed_Implementation_Graph.h"
+
+// Function: dispatchGraph
+// Parameters:
+// const IGraph& graph - graph of any concrete type
+// F&& f - generic callable, invoked as f(const ConcreteGraph&)
+// Output:
+// Returns f applied to graph viewed as its concrete type
+template <typename F>
+auto dispatchGraph(const IGraph& graph, F&& f) -> decltype(f(graph)) {
+    if (const ListGraph* g = dynamic_cast<const ListGraph*>(&graph)) return f(*g);
+    if (const CSRGraph* g = dynamic_cast<const CSRGraph*>(&graph)) return f(*g);
+    if (const MatrixGraph* g = dynamic_cast<const MatrixGraph*>(&graph)) return f(*g);
+    if (const CompressedGraph* g = dynamic_cast<const CompressedGraph*>(&graph)) return f(*g);
+    return f(graph);
+}
+
+#endif
@@ -0,0 +1,201 @@
+//***************************************************************
+// File: Graph_Reordering.h
+// Description:
+//   Vertex reordering for memory locality. A strategy computes a
+//   permutation of the vertex IDs, the graph is relabeled into a new
+//   graph of the same representation, and the permutation maps any
+//   result computed on the relabeled graph back to the original IDs.
+//
+// Strategies:
+//   - ReverseCuthillMcKee: BFS by ascending degree from a low-degree
+//     start in every component, then reversed (small bandwidth)
+//   - DegreeDescending: highest degree first
+//   - BFSOrder / DFSOrder: traversal order, component by component
+//   - HubClustering: vertices with above-average degree first, both
+//     groups keeping their original relative order
+//
+// Example:
+//   VertexPermutation perm = computeVertexOrder(g, ReorderStrategy::ReverseCuthillMcKee);
+//   IGraph* h = relabelGraph(g, perm);
+//   vector<int> comp;
+//   kosarajuSCC(*h, comp);
+//   comp = perm.valuesToOld(comp);      // indexed by original IDs
+//
+// Notes:
+//   - "new" IDs are positions in the computed order, "old" IDs are
+//     the IDs of the input graph
+//   - Directed graphs are treated as undirected when ordering (both
+//     out- and in-neighbors count), since locality matters both ways
+//***************************************************************
+
+#ifndef GRAPH_REORDERING_H
+#define GRAPH_REORDERING_H
+
+#include "IGraph.h"
+#include <vector>
+using namespace std;
+
+// Enum: ReorderStrategy
+// Purpose:
+//   Selects how computeVertexOrder ranks the vertices.
+enum class ReorderStrategy {
+    ReverseCuthillMcKee,
+    DegreeDescending,
+    BFSOrder,
+    DFSOrder,
+    HubClustering
+};
+
+// Class: VertexPermutation
+// Purpose:
+//   Bijection between original ("old") and relabeled ("new") IDs,
+//   with helpers to translate results in either direction.
+class VertexPermutation {
+private:
+    vector<int> newToOld;
+    vector<int> oldToNew;
+
+public:
+    // Function: VertexPermutation (Constructor)
+    // Parameters:
+    // None
+    // Output:
+    // Creates an empty permutation (0 vertices)
+    VertexPermutation() = default;
+
+    // Function: VertexPermutation (Constructor)
+    // Parameters:
+    // vector<int> order - order[newId] = oldId, a permutation of 0..n-1
+    // Output:
+    // Stores the order and derives the inverse mapping
+    explicit VertexPermutation(vector<int> order);
+
+    // Function: identity
+    // Parameters:
+    // int n - number of vertices
+    // Output:
+    // Returns the permutation that keeps every ID
+    static VertexPermutation identity(int n);
+
+    // Function: size
+    // Parameters:
+    // None
+    // Output:
+    // Returns the number of vertices
+    int size() const;
+
+    // Function: isBijection
+    // Parameters:
+    // None
+    // Output:
+    // Returns true if the order lists every ID in 0..size()-1 exactly
+    // once (duplicated or out-of-range entries leave IDs unmapped)
+    bool isBijection() const;
+
+    // Function: toNew
+    // Parameters:
+    // int oldId - original vertex ID
+    // Output:
+    // Returns the relabeled ID, or -1 if oldId is out of range
+    int toNew(int oldId) const;
+
+    // Function: toOld
+    // Parameters:
+    // int newId - relabeled vertex ID
+    // Output:
+    // Returns the original ID, or -1 if newId is out of range
+    int toOld(int newId) const;
+
+    // Function: getNewToOld / getOldToNew
+    // Parameters:
+    // None
+    // Output:
+    // Returns the underlying mapping arrays
+    const vector<int>& getNewToOld() const;
+    const vector<int>& getOldToNew() const;
+
+    // Function: valuesToOld
+    // Parameters:
+    // const vector<T>& byNew - per-vertex values indexed by new ID
+    // Output:
+    // Returns the same values indexed by original ID
+    // Notes:
+    // - For values that are not vertex IDs (distance, componentId,
+    //   color); use parentsToOld when the values are IDs too
+    template <typename T>
+    vector<T> valuesToOld(const vector<T>& byNew) const {
+        vector<T> byOld(byNew.size());
+        for (size_t v = 0; v < byNew.size() && v < newToOld.size(); v++) {
+            byOld[newToOld[v]] = byNew[v];
+        }
+        return byOld;
+    }
+
+    // Function: valuesToNew
+    // Parameters:
+    // const vector<T>& byOld - per-vertex values indexed by original ID
+    // Output:
+    // Returns the same values indexed by new ID
+    template <typename T>
+    vector<T> valuesToNew(const vector<T>& byOld) const {
+        vector<T> byNew(byOld.size());
+        for (size_t v = 0; v < byOld.size() && v < oldToNew.size(); v++) {
+            byNew[oldToNew[v]] = byOld[v];
+        }
+        return byNew;
+    }
+
+    // Function: verticesToOld
+    // Parameters:
+    // const vector<int>& newIds - list of new IDs (path, SCC, partition)
+    // Output:
+    // Returns the list with every ID translated; invalid IDs become -1
+    vector<int> verticesToOld(const vector<int>& newIds) const;
+
+    // Function: verticesToNew
+    // Parameters:
+    // const vector<int>& oldIds - list of original IDs
+    // Output:
+    // Returns the list with every ID translated; invalid IDs become -1
+    vector<int> verticesToNew(const vector<int>& oldIds) const;
+
+    // Function: parentsToOld
+    // Parameters:
+    // const vector<int>& parentByNew - parent array on the new graph
+    // Output:
+    // Returns the parent array indexed by and pointing at original IDs
+    // Notes:
+    // - -1 entries (roots, unreached vertices) stay -1
+    vector<int> parentsToOld(const vector<int>& parentByNew) const;
+};
+
+// Function: computeVertexOrder
+// Parameters:
+// const IGraph& graph - graph to order
+// ReorderStrategy strategy - ordering to compute
+// int start - first vertex for BFSOrder / DFSOrder (default 0)
+// Output:
+// Returns the permutation (new ID = position in the order)
+VertexPermutation computeVertexOrder(const IGraph& graph,
+                                     ReorderStrategy strategy,
+                                     int start = 0);
+
+// Function: relabelGraph
+// Parameters:
+// const IGraph& graph - graph to relabel
+// const VertexPermutation& permutation - mapping from computeVertexOrder
+// Output:
+// Returns a new graph where old vertex u is permutation.toNew(u), or
+// nullptr if permutation is not a bijection on graph's vertices
+// Notes:
+// - Keeps the representation: ListGraph, MatrixGraph, CSRGraph and
+//   CompressedGraph inputs give the same type back, other IGraph
+//   types give a ListGraph
+// - Neighbor order is kept (only the IDs change), except for
+//   representations that always store rows sorted
+// - Edge weights of weighted List/CSR graphs are carried over
+// - Caller must delete the returned pointer; nullptr if the
+//   permutation size does not match the graph
+IGraph* relabelGraph(const IGraph& graph, const VertexPermutation& permutation);
+
+#endif
@@ -0,0 +1,97 @@
+//***************************************************************
+// File: Graph_Text_Import.h
+// Description:
+//   Fast loader for text edge-list files. The file is mapped into
+//   memory, cut into line-aligned chunks, parsed in parallel with a
+//   hand-written integer parser, and the per-thread edge buffers go
+//   straight into the bulk builder (Graph_Builder.h).
+//
+// Supported Formats:
+//   - Edge list (SNAP style): one "u v" pair per line, 0-based,
+//     '#' or '%' starts a comment line, extra columns are ignored
+//   - Matrix Market coordinate: "%%MatrixMarket matrix coordinate"
+//     header, size line "rows cols entries", then 1-based "i j [value]"
+//
+// Notes:
+//   - Bad lines are counted and sampled in an ImportReport instead of
+//     stopping the import or asking for input again
+//   - Matrix Market symmetry decides directedness: "general" is
+//     directed, every symmetric kind is undirected
+//***************************************************************
+
+#ifndef GRAPH_TEXT_IMPORT_H
+#define GRAPH_TEXT_IMPORT_H
+
+#include "IGraph.h"
+#include "Graph_Builder.h"
+#include <string>
+#include <vector>
+using namespace std;
+
+// Enum: TextGraphFormat
+// Purpose:
+//   Input format; Auto looks for the Matrix Market banner.
+enum class TextGraphFormat {
+    Auto,
+    EdgeList,
+    MatrixMarket
+};
+
+// Struct: TextImportOptions
+// Purpose:
+//   Controls parsing and the graph that is built.
+struct TextImportOptions {
+    TextGraphFormat format = TextGraphFormat::Auto;
+    bool directed = false;          // edge lists only
+    int vertices = 0;               // edge lists: 0 = largest id + 1
+    bool dropSelfLoops = false;
+    bool deduplicate = false;
+    bool buildList = false;         // ListGraph instead of CSRGraph
+    int threads = 0;                // 0 = hardware thread count
+    int maxReportedLines = 10;      // rejected lines kept as samples
+};
+
+// Struct: RejectedLine
+// Purpose:
+//   One input line that could not be turned into an edge.
+struct RejectedLine {
+    long long lineNumber;           // 1-based
+    string text;
+    string reason;
+};
+
+// Struct: ImportReport
+// Purpose:
+//   Summary of an import; filled even when the import fails.
+struct ImportReport {
+    long long bytes = 0;
+    long long lines = 0;
+    long long commentLines = 0;     // comments, headers and blank lines
+    long long edgesParsed = 0;
+    long long rejectedLines = 0;
+    vector<RejectedLine> rejectedSamples;   // first few, in file order
+    GraphBuildStats build;
+    string error;                   // non-empty if no graph was built
+};
+
+// Function: importTextGraph
+// Parameters:
+// const string& filename - text file to read
+// const TextImportOptions& options - parsing and build options
+// ImportReport* report - optional output report (may be nullptr)
+// Output:
+// Returns a new CSRGraph (or ListGraph), or nullptr on failure
+// Notes:
+// - Caller must delete the returned pointer
+IGraph* importTextGraph(const string& filename,
+                        const TextImportOptions& options,
+                        ImportReport* report = nullptr);
+
+// Function: printImportReport
+// Parameters:
+// const ImportReport& report - report to print
+// Output:
+// Prints counts and the sampled rejected lines
+void printImportReport(const ImportReport& report);
+
+#endif
@@ -0,0 +1,125 @@
+//***************************************************************
+// File: Graph_Traversal.h
+// Description:
+//   Non-printing BFS and DFS engines driven by visitor callbacks.
+//
+//   This module provides:
+//     - TraversalVisitor: callbacks for discovered vertices, examined
+//       edges and finished vertices; any callback can stop the search
+//     - TraversalResult: visit order, parent and depth arrays
+//     - breadthFirstTraversal / depthFirstTraversal from one start
+//
+// Example (first k reachable vertices that match a predicate):
+//   struct FirstMatches : TraversalVisitor {
+//       vector<int> found;
+//       bool discoverVertex(int u, int) override {
+//           if (matches(u)) found.push_back(u);
+//           return found.size() < k;         // false = stop
+//       }
+//   };
+//
+// Notes:
+//   - The BFS() and DFS() printers are thin wrappers over these
+//   - DFS runs on DFSEngine (explicit stack), so deep graphs cannot
+//     overflow the call stack; the visit order is the same as
+//     recursive DFS
+//***************************************************************
+
+#ifndef GRAPH_TRAVERSAL_H
+#define GRAPH_TRAVERSAL_H
+
+#include "IGraph.h"
+#include <vector>
+using namespace std;
+
+// Class: TraversalVisitor
+// Purpose:
+//   Event callbacks of breadthFirstTraversal / depthFirstTraversal.
+// Notes:
+//   - Every callback returns true to continue, false to stop the
+//     whole traversal at once
+//   - The defaults do nothing and continue, so a visitor only
+//     overrides the events it needs
+class TraversalVisitor {
+public:
+    virtual ~TraversalVisitor() = default;
+
+    // Called once per vertex when it is first reached
+    // (BFS: when queued; DFS: when entered), depth = edges from start
+    virtual bool discoverVertex(int u, int depth) {
+        (void)u;
+        (void)depth;
+        return true;
+    }
+
+    // Called for every edge u -> v scanned out of a discovered vertex,
+    // before v is discovered (if it is new)
+    virtual bool examineEdge(int u, int v) {
+        (void)u;
+        (void)v;
+        return true;
+    }
+
+    // Called once all edges out of u have been examined
+    // (DFS: after every vertex below u is finished)
+    virtual bool finishVertex(int u) {
+        (void)u;
+        return true;
+    }
+};
+
+// Struct: TraversalResult
+// Purpose:
+//   Output of a traversal from one start vertex.
+// Notes:
+//   - parent and depth have V entries; vertices not discovered keep
+//     -1 (the start has parent -1 and depth 0)
+//   - After an early stop the arrays describe the part of the search
+//     done so far
+struct TraversalResult {
+    vector<int> order;      // vertices in discovery order
+    vector<int> parent;     // tree parent of each discovered vertex
+    vector<int> depth;      // tree depth (BFS: shortest distance)
+    bool stopped = false;   // true if a callback returned false
+};
+
+// Function: breadthFirstTraversal
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - starting vertex
+// TraversalVisitor& visitor - event callbacks
+// Output:
+// Returns order/parent/depth of the BFS from start
+// Notes:
+// - Returns an empty result if start is invalid
+TraversalResult breadthFirstTraversal(const IGraph& graph, int start, TraversalVisitor& visitor);
+
+// Function: breadthFirstTraversal
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - starting vertex
+// Output:
+// Returns order/parent/depth of the BFS from start (no callbacks)
+TraversalResult breadthFirstTraversal(const IGraph& graph, int start);
+
+// Function: depthFirstTraversal
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - starting vertex
+// TraversalVisitor& visitor - event callbacks
+// Output:
+// Returns order/parent/depth of the DFS from start
+// Notes:
+// - Returns an empty result if start is invalid
+// - order is DFS preorder, identical to the recursive version
+TraversalResult depthFirstTraversal(const IGraph& graph, int start, TraversalVisitor& visitor);
+
+// Function: depthFirstTraversal
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - starting vertex
+// Output:
+// Returns order/parent/depth of the DFS from start (no callbacks)
+TraversalResult depthFirstTraversal(const IGraph& graph, int start);
+
+#endif
@@ -5,6 +5,7 @@
 //
 // Notes:
 //   - A tree must be undirected, connected, and acyclic
+//   - Checked as: undirected, V - 1 edges, no self-loop, connected
 //***************************************************************
 
 #ifndef GRAPH_TREE_H
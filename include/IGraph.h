@@ -10,8 +10,124 @@
 #define IGRAPH_H
 
 #include <vector>
+#include <memory>
+#include <type_traits>
 using namespace std;
 
+// Function: callNeighborVisitor
+// Parameters:
+// F& visit - callable taking one neighbor (int)
+// int v - neighbor to report
+// Output:
+// Returns false if visit asked to stop, true otherwise
+// Notes:
+// - Callables may return void (never stop) or bool (false = stop)
+template <typename F>
+inline bool callNeighborVisitor(F& visit, int v) {
+    if constexpr (is_void<decltype(visit(v))>::value) {
+        visit(v);
+        return true;
+    } else {
+        return static_cast<bool>(visit(v));
+    }
+}
+
+// Class: NeighborVisitor
+// Purpose:
+//   Non-owning reference to a neighbor callback, used by
+//   IGraph::forEachNeighbor.
+// Notes:
+//   - Unlike std::function it never allocates, so building one per
+//     vertex inside a traversal loop is free
+//   - Only valid while the wrapped callable is alive (pass lambdas
+//     directly as the argument)
+class NeighborVisitor {
+private:
+    void* callable;
+    bool (*invoke)(void*, int);
+
+    template <typename F>
+    static bool invokeCallable(void* callable, int v) {
+        return callNeighborVisitor(*static_cast<F*>(callable), v);
+    }
+
+public:
+    template <typename F,
+              typename = typename enable_if<
+                  !is_same<typename decay<F>::type, NeighborVisitor>::value>::type>
+    NeighborVisitor(F&& visit)
+        : callable(const_cast<void*>(static_cast<const void*>(addressof(visit)))),
+          invoke(&invokeCallable<typename remove_reference<F>::type>) {}
+
+    // Returns false if the callback asked to stop iterating
+    bool operator()(int v) const { return invoke(callable, v); }
+};
+
+// Type: EdgeWeight
+// Purpose:
+//   Weight of one edge. Unweighted graphs report 1 for every edge.
+using EdgeWeight = long long;
+
+// Function: callWeightedNeighborVisitor
+// Parameters:
+// F& visit - callable taking one neighbor (int) and its edge weight
+// int v - neighbor to report
+// EdgeWeight w - weight of the edge to v
+// Output:
+// Returns false if visit asked to stop, true otherwise
+template <typename F>
+inline bool callWeightedNeighborVisitor(F& visit, int v, EdgeWeight w) {
+    if constexpr (is_void<decltype(visit(v, w))>::value) {
+        visit(v, w);
+        return true;
+    } else {
+        return static_cast<bool>(visit(v, w));
+    }
+}
+
+// Class: WeightedNeighborVisitor
+// Purpose:
+//   Non-owning reference to a (neighbor, weight) callback, used by
+//   IGraph::forEachWeightedNeighbor. Same rules as NeighborVisitor.
+class WeightedNeighborVisitor {
+private:
+    void* callable;
+    bool (*invoke)(void*, int, EdgeWeight);
+
+    template <typename F>
+    static bool invokeCallable(void* callable, int v, EdgeWeight w) {
+        return callWeightedNeighborVisitor(*static_cast<F*>(callable), v, w);
+    }
+
+public:
+    template <typename F,
+              typename = typename enable_if<
+                  !is_same<typename decay<F>::type, WeightedNeighborVisitor>::value>::type>
+    WeightedNeighborVisitor(F&& visit)
+        : callable(const_cast<void*>(static_cast<const void*>(addressof(visit)))),
+          invoke(&invokeCallable<typename remove_reference<F>::type>) {}
+
+    // Returns false if the callback asked to stop iterating
+    bool operator()(int v, EdgeWeight w) const { return invoke(callable, v, w); }
+};
+
+// Struct: NeighborCursor
+// Purpose:
+//   Resumable position inside one vertex's neighbor list, for
+//   algorithms that scan a row a little at a time (iterative DFS).
+// Notes:
+//   - Created by IGraph::neighborCursor / inNeighborCursor and only
+//     meaningful to the graph that created it
+//   - position / end / next are representation-specific
+//   - A cursor is invalidated by any change to the graph
+struct NeighborCursor {
+    int vertex = -1;            // vertex whose row is scanned
+    bool incoming = false;      // true = in-neighbors
+    long long position = 0;
+    long long end = 0;
+    long long next = 0;
+};
+
 class IGraph {
 public:
     virtual ~IGraph() = default;
@@ -25,9 +141,77 @@ public:
     virtual bool isDirected() const = 0;
     virtual vector<int> getNeighbors(int u) const = 0;
 
+    // Zero-copy neighbor iteration (REQUIRED)
+    // Calls visit(v) for every neighbor v of u, in getNeighbors order.
+    // Stops early if visit returns false. Does nothing if u is invalid.
+    virtual void forEachNeighbor(int u, NeighborVisitor visit) const = 0;
+
+    // Incoming-edge iteration (REQUIRED)
+    // Calls visit(w) for every edge w -> u. Directed graphs report w in
+    // ascending order; undirected graphs simply forward to forEachNeighbor.
+    // Implementations may build a reverse adjacency lazily on first use.
+    virtual void forEachInNeighbor(int u, NeighborVisitor visit) const = 0;
+
     // Degree queries (REQUIRED)
     virtual int getOutDegree(int v) const = 0;
     virtual int getInDegree(int v) const = 0;
+
+    // Resumable neighbor iteration (OPTIONAL)
+    // neighborCursor(u) / inNeighborCursor(u) start a scan of the out- /
+    // in-neighbors of u; each nextNeighbor call stores the next one in v
+    // and returns false at the end of the row. The order is the same as
+    // forEachNeighbor / forEachInNeighbor. The defaults re-walk the row up
+    // to the cursor on every call (O(degree) per step); the built-in
+    // graphs override them with O(1) steps.
+    virtual NeighborCursor neighborCursor(int u) const {
+        NeighborCursor cursor;
+        cursor.vertex = u;
+        return cursor;
+    }
+
+    virtual NeighborCursor inNeighborCursor(int u) const {
+        NeighborCursor cursor;
+        cursor.vertex = u;
+        cursor.incoming = true;
+        return cursor;
+    }
+
+    virtual bool nextNeighbor(NeighborCursor& cursor, int& v) const {
+        long long index = 0;
+        bool found = false;
+        auto visit = [&](int w) {
+            if (index++ < cursor.position) return true;
+            v = w;
+            found = true;
+            return false;
+        };
+
+        if (cursor.incoming) {
+            forEachInNeighbor(cursor.vertex, visit);
+        } else {
+            forEachNeighbor(cursor.vertex, visit);
+        }
+
+        if (found) cursor.position++;
+        return found;
+    }
+
+    // Weighted edges (OPTIONAL)
+    // addWeightedEdge stores an edge with a non-negative weight; the
+    // default only accepts weight 1 (representations without weight
+    // storage). forEachWeightedNeighbor reports (v, weight) in
+    // forEachNeighbor order; the default reports weight 1 for every edge.
+    virtual bool addWeightedEdge(int u, int v, EdgeWeight w) {
+        return w == 1 && addEdge(u, v);
+    }
+
+    virtual bool isWeighted() const {
+        return false;
+    }
+
+    virtual void forEachWeightedNeighbor(int u, WeightedNeighborVisitor visit) const {
+        forEachNeighbor(u, [&](int v) { return visit(v, 1); });
+    }
 };
 
 #endif
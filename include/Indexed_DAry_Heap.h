@@ -0,0 +1,206 @@
+//***************************************************************
+// File: Indexed_DAry_Heap.h
+// Description:
+//   Indexed d-ary min-heap of vertices keyed by EdgeWeight, with
+//   decrease-key. Used by the weighted shortest-path algorithms.
+//
+//   Entries (key, vertex) are stored side by side in one array, so a
+//   sift compares keys without chasing pointers, and the children of
+//   a node are Arity consecutive entries (one or two cache lines for
+//   Arity = 4). position[v] is v's slot in the array, or -1.
+//
+// Example:
+//   IndexedDAryHeap<4> heap(V);
+//   heap.pushOrDecrease(start, 0);
+//   while (!heap.empty()) {
+//       EdgeWeight d;
+//       int u = heap.pop(d);
+//       ...
+//   }
+//
+// Notes:
+//   - Header-only; vertices must lie in [0, capacity)
+//   - A wider heap is shallower (fewer levels per pop) but compares
+//     more children per level; 4 is the usual sweet spot
+//***************************************************************
+
+#ifndef INDEXED_DARY_HEAP_H
+#define INDEXED_DARY_HEAP_H
+
+#include "IGraph.h"
+#include <vector>
+using namespace std;
+
+// Class: IndexedDAryHeap
+// Purpose:
+//   Min-heap over vertex IDs with O(1) membership tests and
+//   O(log_Arity n) push, pop and decrease-key.
+template <int Arity = 4>
+class IndexedDAryHeap {
+    static_assert(Arity >= 2, "IndexedDAryHeap needs at least 2 children per node");
+
+private:
+    // Struct: Entry
+    // Purpose:
+    //   One heap slot.
+    struct Entry {
+        EdgeWeight key;
+        int vertex;
+    };
+
+    vector<Entry> heap;
+    vector<int> position;   // slot of each vertex, -1 = not queued
+
+    // Function: place
+    // Parameters:
+    // size_t slot - heap index
+    // const Entry& entry - entry to store
+    // Output:
+    // Writes entry into slot and records its position
+    void place(size_t slot, const Entry& entry) {
+        heap[slot] = entry;
+        position[entry.vertex] = (int)slot;
+    }
+
+    // Function: siftUp
+    // Parameters:
+    // size_t slot - index of an entry whose key may be too small
+    // Output:
+    // Moves the entry up until its parent is not larger
+    void siftUp(size_t slot) {
+        Entry moving = heap[slot];
+        while (slot > 0) {
+            size_t parent = (slot - 1) / Arity;
+            if (heap[parent].key <= moving.key) break;
+            place(slot, heap[parent]);
+            slot = parent;
+        }
+        place(slot, moving);
+    }
+
+    // Function: siftDown
+    // Parameters:
+    // size_t slot - index of an entry whose key may be too large
+    // Output:
+    // Moves the entry down until no child is smaller
+    void siftDown(size_t slot) {
+        Entry moving = heap[slot];
+        size_t n = heap.size();
+
+        while (true) {
+            size_t first = slot * Arity + 1;
+            if (first >= n) break;
+
+            size_t last = first + Arity < n ? first + Arity : n;
+            size_t best = first;
+            for (size_t c = first + 1; c < last; c++) {
+                if (heap[c].key < heap[best].key) best = c;
+            }
+
+            if (heap[best].key >= moving.key) break;
+            place(slot, heap[best]);
+            slot = best;
+        }
+        place(slot, moving);
+    }
+
+public:
+    // Function: IndexedDAryHeap (Constructor)
+    // Parameters:
+    // int capacity - number of vertex IDs (vertices are 0..capacity-1)
+    // Output:
+    // Creates an empty heap
+    explicit IndexedDAryHeap(int capacity = 0) : position(capacity > 0 ? capacity : 0, -1) {}
+
+    // Function: reset
+    // Parameters:
+    // int capacity - new number of vertex IDs
+    // Output:
+    // Empties the heap and resizes the position index
+    void reset(int capacity) {
+        heap.clear();
+        position.assign(capacity > 0 ? capacity : 0, -1);
+    }
+
+    // Function: clear
+    // Parameters:
+    // None
+    // Output:
+    // Empties the heap in O(size), keeping the position index
+    void clear() {
+        for (const Entry& e : heap) position[e.vertex] = -1;
+        heap.clear();
+    }
+
+    // Function: empty / size
+    // Parameters:
+    // None
+    // Output:
+    // Returns whether the heap is empty / the number of queued vertices
+    bool empty() const { return heap.empty(); }
+    int size() const { return (int)heap.size(); }
+
+    // Function: contains
+    // Parameters:
+    // int v - vertex ID
+    // Output:
+    // Returns true if v is queued
+    bool contains(int v) const { return position[v] != -1; }
+
+    // Function: vertexAt
+    // Parameters:
+    // int slot - heap index in [0, size())
+    // Output:
+    // Returns the vertex stored in slot (for scans over the queue)
+    int vertexAt(int slot) const { return heap[slot].vertex; }
+
+    // Function: topKey
+    // Parameters:
+    // None
+    // Output:
+    // Returns the smallest key (heap must not be empty)
+    EdgeWeight topKey() const { return heap[0].key; }
+
+    // Function: pushOrDecrease
+    // Parameters:
+    // int v - vertex ID
+    // EdgeWeight key - new key
+    // Output:
+    // Queues v with key, or lowers its key if it is queued with a
+    // larger one; returns true if the heap changed
+    bool pushOrDecrease(int v, EdgeWeight key) {
+        int slot = position[v];
+        if (slot == -1) {
+            heap.push_back({key, v});
+            siftUp(heap.size() - 1);
+            return true;
+        }
+        if (key >= heap[slot].key) return false;
+
+        heap[slot].key = key;
+        siftUp((size_t)slot);
+        return true;
+    }
+
+    // Function: pop
+    // Parameters:
+    // EdgeWeight& key - receives the key of the removed vertex
+    // Output:
+    // Removes and returns the vertex with the smallest key (heap must
+    // not be empty)
+    int pop(EdgeWeight& key) {
+        Entry top = heap[0];
+        position[top.vertex] = -1;
+        key = top.key;
+
+        Entry last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            heap[0] = last;
+            siftDown(0);
+        }
+        return top.vertex;
+    }
+};
+
+#endif
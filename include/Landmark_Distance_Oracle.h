@@ -0,0 +1,204 @@
+//***************************************************************
+// File: Landmark_Distance_Oracle.h
+// Description:
+//   Landmark-based distance oracle for many s-t queries against one
+//   static graph (ALT-style preprocessing).
+//
+//   build() picks k landmarks and stores, for every vertex v and
+//   landmark L, the BFS distances d(L, v) and d(v, L). A query then
+//   uses the triangle inequality:
+//     - upper bound: min over L of d(s, L) + d(L, t)
+//     - lower bound: max over L of d(L, t) - d(L, s) and
+//                    d(s, L) - d(t, L)
+//   and, in exact mode, prunes a bidirectional BFS with those bounds.
+//
+// Landmark selection:
+//   - HighestDegree: the k vertices with the largest in + out degree
+//   - FarthestFirst: starts at the highest-degree vertex, then always
+//     adds the vertex farthest from every landmark chosen so far
+//     (unreachable counts as farthest, so every component gets one)
+//
+// File Layout (native byte order):
+//   [0, 64)   header ("GRAPHLMK", version, flags, V, k, graph entry
+//             count, FNV-1a checksum of the body, byte-order mark)
+//   int32 landmarks[k]
+//   int32 fromLandmark[V * k]   d(L_i, v) at [v * k + i]
+//   int32 toLandmark[V * k]     d(v, L_i), directed graphs only
+//
+// Notes:
+//   - Distances are stored vertex-major, so one query reads two
+//     contiguous rows of k entries
+//   - Undirected graphs store one table, since d(L, v) = d(v, L)
+//   - The oracle only describes the graph it was built on; load()
+//     followed by matchesGraph() guards against a different graph
+//***************************************************************
+
+#ifndef LANDMARK_DISTANCE_ORACLE_H
+#define LANDMARK_DISTANCE_ORACLE_H
+
+#include "IGraph.h"
+#include "Shortest_Path_Unweighted.h"
+#include <vector>
+#include <string>
+using namespace std;
+
+// Enum: LandmarkSelection
+// Purpose:
+//   Strategy used by LandmarkDistanceOracle::build to pick landmarks.
+enum class LandmarkSelection {
+    HighestDegree,
+    FarthestFirst
+};
+
+// Struct: LandmarkOracleOptions
+// Purpose:
+//   Preprocessing parameters of the oracle.
+struct LandmarkOracleOptions {
+    int landmarks = 16;     // number of landmarks (capped at V)
+    LandmarkSelection selection = LandmarkSelection::HighestDegree;
+    int threads = 0;        // BFS workers (0 = hardware thread count)
+};
+
+// Struct: DistanceBounds
+// Purpose:
+//   Answer of an approximate query: lower <= d(s, t) <= upper.
+// Notes:
+//   - upper = -1 means no landmark connects s to t (no finite bound)
+//   - unreachable = true means the landmarks prove t is not reachable
+//     from s; lower and upper are then -1
+struct DistanceBounds {
+    int lower = 0;
+    int upper = -1;
+    bool unreachable = false;
+};
+
+// Struct: OracleQueryStats
+// Purpose:
+//   Work counters of an exact query.
+struct OracleQueryStats {
+    long long verticesVisited = 0;  // discovered by the search
+    long long verticesPruned = 0;   // discovered but not expanded
+    bool answeredByBounds = false;  // lower == upper, no search needed
+};
+
+// Class: LandmarkDistanceOracle
+// Purpose:
+//   Precomputed landmark distances with bound and exact queries.
+class LandmarkDistanceOracle {
+private:
+    int V;
+    bool directed;
+    long long graphEntries;         // sum of out-degrees at build time
+    vector<int> landmarks;
+    vector<int> fromLandmark;       // d(L_i, v) at [v * k + i], -1 = none
+    vector<int> toLandmark;         // d(v, L_i), directed graphs only
+
+    // Function: lowerBoundOrUnreachable
+    // Parameters:
+    // int s - source vertex
+    // int t - target vertex
+    // Output:
+    // Returns the best landmark lower bound on d(s, t), or -1 if the
+    // landmarks prove that t is unreachable from s
+    int lowerBoundOrUnreachable(int s, int t) const;
+
+    // Function: upperBoundOrNone
+    // Parameters:
+    // int s - source vertex
+    // int t - target vertex
+    // Output:
+    // Returns the best landmark upper bound on d(s, t), or -1
+    int upperBoundOrNone(int s, int t) const;
+
+public:
+    // Function: LandmarkDistanceOracle (Constructor)
+    // Parameters:
+    // None
+    // Output:
+    // Creates an empty oracle (call build or load)
+    LandmarkDistanceOracle();
+
+    // Function: build
+    // Parameters:
+    // const IGraph& graph - graph to index
+    // const LandmarkOracleOptions& options - landmark count and strategy
+    // Output:
+    // Replaces the index with one built for graph
+    // Notes:
+    // - Runs 1 BFS per landmark on undirected graphs, 2 on directed
+    //   graphs (the second over incoming edges)
+    void build(const IGraph& graph, const LandmarkOracleOptions& options = LandmarkOracleOptions());
+
+    // Function: bounds
+    // Parameters:
+    // int s - source vertex
+    // int t - target vertex
+    // Output:
+    // Returns triangle-inequality bounds on d(s, t), O(k)
+    // Notes:
+    // - s == t gives lower = upper = 0; invalid vertices give unreachable
+    DistanceBounds bounds(int s, int t) const;
+
+    // Function: exactDistance
+    // Parameters:
+    // const IGraph& graph - the graph the oracle was built on
+    // int s - source vertex
+    // int t - target vertex
+    // BidirectionalBFSWorkspace& workspace - scratch arrays reused across calls
+    // vector<int>* path - optional output shortest path (may be nullptr)
+    // OracleQueryStats* stats - optional work counters (may be nullptr)
+    // Output:
+    // Returns d(s, t), or -1 if t is unreachable from s
+    // Notes:
+    // - Returns immediately when the bounds already agree (unless a
+    //   path is requested)
+    // - Otherwise runs a bidirectional BFS that skips every vertex
+    //   whose distance so far plus its landmark lower bound to the
+    //   other end cannot beat the best known path
+    int exactDistance(const IGraph& graph,
+                      int s,
+                      int t,
+                      BidirectionalBFSWorkspace& workspace,
+                      vector<int>* path = nullptr,
+                      OracleQueryStats* stats = nullptr) const;
+
+    // Function: save
+    // Parameters:
+    // const string& filename - output file
+    // Output:
+    // Returns true if the whole index was written
+    bool save(const string& filename) const;
+
+    // Function: load
+    // Parameters:
+    // const string& filename - file written by save
+    // string* error - optional message on failure (may be nullptr)
+    // Output:
+    // Replaces the index with the file contents; returns false (and
+    // leaves the oracle unchanged) on any format or checksum error
+    bool load(const string& filename, string* error = nullptr);
+
+    // Function: matchesGraph
+    // Parameters:
+    // const IGraph& graph - candidate graph
+    // Output:
+    // Returns true if vertex count, direction and number of adjacency
+    // entries equal those of the graph the index was built on
+    bool matchesGraph(const IGraph& graph) const;
+
+    // Function: getLandmarks
+    // Parameters:
+    // None
+    // Output:
+    // Returns the chosen landmark vertices
+    const vector<int>& getLandmarks() const;
+
+    // Function: getVertexCount
+    // Parameters:
+    // None
+    // Output:
+    // Returns the vertex count of the indexed graph
+    int getVertexCount() const;
+};
+
+#endif
@@ -0,0 +1,125 @@
+//***************************************************************
+// File: Lazy_Cache.h
+// Description:
+//   A value derived from a graph on first use (a reverse adjacency,
+//   in-degree counts), safe to request from several threads at once.
+//
+// Example:
+//   LazyCache<vector<int>> degrees;
+//   const vector<int>& d = degrees.get([&](vector<int>& counts) {
+//       counts.assign(V, 0);
+//       ...
+//   });
+//
+// Notes:
+//   - Double-checked: an atomic flag keeps the common path lock-free,
+//     and the builder runs under a mutex, once
+//   - Copying or moving a cache gives an empty one, so a graph that
+//     holds caches keeps its implicit copy / move; the new graph
+//     rebuilds what it needs on demand
+//   - reset and set are for non-const members of the owner and must
+//     not run concurrently with get
+//***************************************************************
+
+#ifndef LAZY_CACHE_H
+#define LAZY_CACHE_H
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+using namespace std;
+
+// Class: LazyCache
+// Purpose:
+//   Holds a T that is built on first use; copies start out empty.
+template <typename T>
+class LazyCache {
+private:
+    mutable T data;
+    mutable atomic<bool> ready;
+    mutable mutex lock;
+
+public:
+    // Function: LazyCache (Constructor)
+    // Parameters:
+    // None
+    // Output:
+    // Creates an empty cache
+    LazyCache() : ready(false) {}
+
+    // Function: LazyCache (Copy / Move)
+    // Parameters:
+    // const LazyCache& / LazyCache&& - ignored
+    // Output:
+    // Creates an empty cache; the value is never copied
+    LazyCache(const LazyCache&) : ready(false) {}
+    LazyCache(LazyCache&&) noexcept : ready(false) {}
+
+    // Function: operator= (Copy / Move)
+    // Parameters:
+    // const LazyCache& / LazyCache&& - ignored
+    // Output:
+    // Empties this cache
+    LazyCache& operator=(const LazyCache&) {
+        reset();
+        return *this;
+    }
+
+    LazyCache& operator=(LazyCache&&) noexcept {
+        reset();
+        return *this;
+    }
+
+    // Function: get
+    // Parameters:
+    // F&& build - callable build(T&) that fills the value
+    // Output:
+    // Returns the value, running build first if it is missing
+    template <typename F>
+    const T& get(F&& build) const {
+        if (ready.load(memory_order_acquire)) return data;
+
+        lock_guard<mutex> guard(lock);
+        if (!ready.load(memory_order_relaxed)) {
+            build(data);
+            ready.store(true, memory_order_release);
+        }
+        return data;
+    }
+
+    // Function: value
+    // Parameters:
+    // None
+    // Output:
+    // Returns the value without building it
+    // Notes:
+    // - Only valid after a get on the same thread (e.g. a cursor that
+    //   was opened through get)
+    const T& value() const {
+        return data;
+    }
+
+    // Function: set
+    // Parameters:
+    // T&& value - ready-made value
+    // Output:
+    // Stores value as if it had been built
+    void set(T&& value) {
+        data = move(value);
+        ready.store(true, memory_order_release);
+    }
+
+    // Function: reset
+    // Parameters:
+    // None
+    // Output:
+    // Drops the value; the next get builds it again
+    void reset() {
+        if (!ready.load(memory_order_relaxed)) return;
+
+        ready.store(false, memory_order_relaxed);
+        data = T();
+    }
+};
+
+#endif
@@ -7,28 +7,77 @@
 // Notes:
 //   - Works for directed and undirected graphs
 //   - Stores neighbors in adjacency lists
+//   - In-degrees are counted in addEdge; the reverse adjacency is
+//     built only when an algorithm asks for incoming edges
+//   - Edge weights are optional: the first addWeightedEdge allocates
+//     a weight list parallel to every neighbor list (earlier edges
+//     get weight 1); unweighted graphs pay nothing
+//   - Incremental connectivity is opt-in: once enabled, addEdge also
+//     keeps a union-find, the edge count and a cycle flag current, so
+//     isConnected / isTree answer without traversing the graph
 //***************************************************************
 
 #ifndef LIST_IMPLEMENTATION_GRAPH_H
 #define LIST_IMPLEMENTATION_GRAPH_H
 
 #include "IGraph.h"
+#include "Union_Find.h"
+#include "Lazy_Cache.h"
 #include <vector>
 #include <iostream>
 using namespace std;
 
-class ListGraph : public IGraph {
+class ListGraph final : public IGraph {
 private:
     int V;
     bool directed;
     vector<vector<int>> adj;
+    vector<int> inDegree;   // maintained by addEdge
+    bool weighted;
+    vector<vector<EdgeWeight>> weights; // parallel to adj once weighted
+
+    // Incremental connectivity (see enableConnectivityTracking)
+    bool tracking;
+    UnionFind components;   // edges treated as undirected
+    long long edgeCount;
+    bool cycleSeen;         // some edge joined two connected vertices
+
+    // Lazily built reverse adjacency (directed graphs only)
+    LazyCache<vector<vector<int>>> reverseAdj;
+
+    // Function: ensureReverseAdjacency
+    // Parameters:
+    // None
+    // Output:
+    // Returns reverseAdj, building it if it is missing or stale
+    // Notes:
+    // - Safe to call from several threads at once
+    const vector<vector<int>>& ensureReverseAdjacency() const;
+
+    // Function: enableWeights
+    // Parameters:
+    // None
+    // Output:
+    // Allocates the weight lists, giving every existing edge weight 1
+    void enableWeights();
+
+    // Function: trackEdge
+    // Parameters:
+    // int u - one endpoint
+    // int v - other endpoint
+    // Output:
+    // Counts the edge and unites its endpoints, raising the cycle flag
+    // if they were already connected
+    void trackEdge(int u, int v);
 
     // Function: isValidVertex
     // Parameters:
     // int v - vertex index
     // Output:
     // Returns true if v is within [0, V-1]
-    bool isValidVertex(int v) const;
+    bool isValidVertex(int v) const {
+        return v >= 0 && v < V;
+    }
 
 public:
     // Function: ListGraph (Constructor)
@@ -39,6 +88,33 @@ public:
     // Constructs an empty adjacency list graph
     ListGraph(int vertices, bool isDirected);
 
+    // Function: ListGraph (Constructor)
+    // Parameters:
+    // int vertices - number of vertices
+    // bool isDirected - true for directed graphs
+    // vector<vector<int>>&& adjacency - ready-made neighbor lists
+    // Output:
+    // Adopts the lists without copying and counts in-degrees
+    // Notes:
+    // - Used by the bulk builder; undirected lists must already
+    //   contain both directions of every edge
+    ListGraph(int vertices, bool isDirected, vector<vector<int>>&& adjacency);
+
+    // Function: ListGraph (Constructor)
+    // Parameters:
+    // int vertices - number of vertices
+    // bool isDirected - true for directed graphs
+    // vector<vector<int>>&& adjacency - ready-made neighbor lists
+    // vector<vector<EdgeWeight>>&& rowWeights - weight of every entry
+    // Output:
+    // Adopts weighted lists without copying
+    // Notes:
+    // - rowWeights[u] must have the same length as adjacency[u]
+    ListGraph(int vertices,
+              bool isDirected,
+              vector<vector<int>>&& adjacency,
+              vector<vector<EdgeWeight>>&& rowWeights);
+
     // Function: addEdge
     // Parameters:
     // int u - source vertex
@@ -47,6 +123,76 @@ public:
     // Returns true if edge is added successfully, false if invalid
     bool addEdge(int u, int v) override;
 
+    // Function: addWeightedEdge
+    // Parameters:
+    // int u - source vertex
+    // int v - destination vertex
+    // EdgeWeight w - edge weight (must be >= 0)
+    // Output:
+    // Returns true if edge is added, false if a vertex or w is invalid
+    bool addWeightedEdge(int u, int v, EdgeWeight w) override;
+
+    // Function: isWeighted
+    // Parameters:
+    // None
+    // Output:
+    // Returns true once the graph stores edge weights
+    bool isWeighted() const override;
+
+    // Function: enableConnectivityTracking
+    // Parameters:
+    // None
+    // Output:
+    // Starts incremental connectivity: scans the current edges once,
+    // O(V + E), then every addEdge updates the state in near O(1)
+    // Notes:
+    // - Does nothing if already enabled
+    // - Directed edges are tracked as undirected (weak connectivity),
+    //   and the cycle flag then refers to the undirected graph too
+    void enableConnectivityTracking();
+
+    // Function: isTrackingConnectivity
+    // Parameters:
+    // None
+    // Output:
+    // Returns true once enableConnectivityTracking has been called
+    bool isTrackingConnectivity() const;
+
+    // Function: getComponentCount
+    // Parameters:
+    // None
+    // Output:
+    // Returns the number of (weakly) connected components, O(1), or -1
+    // when tracking is off
+    int getComponentCount() const;
+
+    // Function: inSameComponent
+    // Parameters:
+    // int u - vertex
+    // int v - vertex
+    // Output:
+    // Returns true if u and v are (weakly) connected, O(log V); false
+    // if either is invalid or tracking is off
+    bool inSameComponent(int u, int v) const;
+
+    // Function: getEdgeCount
+    // Parameters:
+    // None
+    // Output:
+    // Returns the number of edges, O(1), or -1 when tracking is off
+    // Notes:
+    // - An undirected edge counts once
+    long long getEdgeCount() const;
+
+    // Function: hasTrackedCycle
+    // Parameters:
+    // None
+    // Output:
+    // Returns true if some edge closed a cycle of the undirected graph
+    // (self-loops and parallel edges included); false when tracking
+    // is off
+    bool hasTrackedCycle() const;
+
     // Function: display
     // Parameters:
     // None
@@ -75,6 +221,133 @@ public:
     // Returns a vector of neighbors of u (empty if u invalid)
     vector<int> getNeighbors(int u) const override;
 
+    // Function: forEachNeighbor
+    // Parameters:
+    // int u - vertex to query
+    // NeighborVisitor visit - callback receiving each neighbor
+    // Output:
+    // Calls visit(v) for every neighbor v of u without copying
+    void forEachNeighbor(int u, NeighborVisitor visit) const override;
+
+    // Function: forEachNeighbor (inline template)
+    // Parameters:
+    // int u - vertex to query
+    // F&& visit - callable taking a neighbor (may return bool to stop)
+    // Output:
+    // Same as the virtual version, but resolved at compile time so the
+    // callback can be inlined (used by the static algorithm layer)
+    template <typename F>
+    void forEachNeighbor(int u, F&& visit) const {
+        if (!isValidVertex(u)) return;
+
+        for (int v : adj[u]) {
+            if (!callNeighborVisitor(visit, v)) return;
+        }
+    }
+
+    // Function: forEachWeightedNeighbor
+    // Parameters:
+    // int u - vertex to query
+    // WeightedNeighborVisitor visit - callback receiving (neighbor, weight)
+    // Output:
+    // Calls visit(v, w) for every edge u -> v, in forEachNeighbor order
+    void forEachWeightedNeighbor(int u, WeightedNeighborVisitor visit) const override;
+
+    // Function: forEachWeightedNeighbor (inline template)
+    // Parameters:
+    // int u - vertex to query
+    // F&& visit - callable taking (neighbor, weight) (may return bool to stop)
+    // Output:
+    // Same as the virtual version, resolved at compile time
+    template <typename F>
+    void forEachWeightedNeighbor(int u, F&& visit) const {
+        if (!isValidVertex(u)) return;
+
+        const vector<int>& row = adj[u];
+        if (!weighted) {
+            for (int v : row) {
+                if (!callWeightedNeighborVisitor(visit, v, 1)) return;
+            }
+            return;
+        }
+
+        const vector<EdgeWeight>& rowWeights = weights[u];
+        for (size_t i = 0; i < row.size(); i++) {
+            if (!callWeightedNeighborVisitor(visit, row[i], rowWeights[i])) return;
+        }
+    }
+
+    // Function: forEachInNeighbor
+    // Parameters:
+    // int u - vertex to query
+    // NeighborVisitor visit - callback receiving each in-neighbor
+    // Output:
+    // Calls visit(w) for every edge w -> u
+    // Notes:
+    // - Directed graphs build the reverse adjacency on first call and
+    //   keep it until the next addEdge
+    void forEachInNeighbor(int u, NeighborVisitor visit) const override;
+
+    // Function: forEachInNeighbor (inline template)
+    // Parameters:
+    // int u - vertex to query
+    // F&& visit - callable taking an in-neighbor (may return bool to stop)
+    // Output:
+    // Same as the virtual version, resolved at compile time
+    template <typename F>
+    void forEachInNeighbor(int u, F&& visit) const {
+        if (!isValidVertex(u)) return;
+
+        if (!directed) {
+            forEachNeighbor(u, visit);
+            return;
+        }
+
+        const vector<vector<int>>& rows = ensureReverseAdjacency();
+        for (int w : rows[u]) {
+            if (!callNeighborVisitor(visit, w)) return;
+        }
+    }
+
+    // Function: neighborCursor / inNeighborCursor
+    // Parameters:
+    // int u - vertex to query
+    // Output:
+    // Returns a cursor at the start of u's out- / in-neighbor list
+    // Notes:
+    // - Inline so static-dispatch callers step without a virtual call
+    NeighborCursor neighborCursor(int u) const override {
+        NeighborCursor cursor;
+        cursor.vertex = u;
+        cursor.end = isValidVertex(u) ? (long long)adj[u].size() : 0;
+        return cursor;
+    }
+
+    NeighborCursor inNeighborCursor(int u) const override {
+        if (!directed || !isValidVertex(u)) return neighborCursor(u);
+
+        const vector<vector<int>>& rows = ensureReverseAdjacency();
+        NeighborCursor cursor;
+        cursor.vertex = u;
+        cursor.incoming = true;
+        cursor.end = (long long)rows[u].size();
+        return cursor;
+    }
+
+    // Function: nextNeighbor
+    // Parameters:
+    // NeighborCursor& cursor - cursor from neighborCursor / inNeighborCursor
+    // int& v - receives the next neighbor
+    // Output:
+    // Returns false once the list is exhausted, O(1)
+    bool nextNeighbor(NeighborCursor& cursor, int& v) const override {
+        if (cursor.position >= cursor.end) return false;
+
+        const vector<int>& row = cursor.incoming ? reverseAdj.value()[cursor.vertex] : adj[cursor.vertex];
+        v = row[cursor.position++];
+        return true;
+    }
+
     // Function: getOutDegree
     // Parameters:
     // int v - vertex to query
@@ -86,7 +359,7 @@ public:
     // Parameters:
     // int v - vertex to query
     // Output:
-    // Returns in-degree of v (0 if invalid)
+    // Returns in-degree of v (0 if invalid), O(1)
     int getInDegree(int v) const override;
 };
 
@@ -6,7 +6,10 @@
 //
 // Notes:
 //   - Best for dense graphs
-//   - Uses matrix[u][v] = 1 when edge exists
+//   - Cells are bits packed into one contiguous array of 64-bit
+//     words (1 bit per cell, rows padded to a whole word)
+//   - Undirected graphs may use upper-triangle mode, which stores
+//     each pair (u,v) with u <= v only and halves memory again
 //***************************************************************
 
 #ifndef MATRIX_IMPLEMENTATION_GRAPH_H
@@ -14,30 +17,127 @@
 
 #include "IGraph.h"
 #include <vector>
+#include <cstdint>
+#include <cstddef>
 #include <iostream>
 using namespace std;
 
-class MatrixGraph : public IGraph {
+class MatrixGraph final : public IGraph {
 private:
     int V;
     bool directed;
-    vector<vector<int>> matrix;
+    bool upperTriangle;     // only used for undirected graphs
+    size_t wordsPerRow;     // full mode: 64-bit words per matrix row
+    vector<uint64_t> bits;  // packed matrix cells
+    vector<int> inDegree;   // cached column counts
 
     // Function: isValidVertex
     // Parameters:
     // int v - vertex index
     // Output:
     // Returns true if v is within [0, V-1]
-    bool isValidVertex(int v) const;
+    bool isValidVertex(int v) const {
+        return v >= 0 && v < V;
+    }
+
+    // Function: triangleRowStart
+    // Parameters:
+    // int u - row index
+    // Output:
+    // Returns the bit index of cell (u,u) in upper-triangle mode
+    // Notes:
+    // - Row i holds columns i..V-1, so rows shrink by one bit each
+    size_t triangleRowStart(int u) const {
+        size_t i = (size_t)u;
+        return i * (size_t)V - (i * (i + 1)) / 2 + i;
+    }
+
+    // Function: bitIndex
+    // Parameters:
+    // int u - row
+    // int v - column
+    // Output:
+    // Returns the bit index that stores cell (u,v)
+    // Notes:
+    // - In upper-triangle mode (u,v) and (v,u) share one bit
+    size_t bitIndex(int u, int v) const {
+        if (upperTriangle) {
+            if (u > v) {
+                int tmp = u;
+                u = v;
+                v = tmp;
+            }
+            return triangleRowStart(u) + (size_t)(v - u);
+        }
+        return (size_t)u * wordsPerRow * 64 + (size_t)v;
+    }
+
+    // Function: testBit
+    // Parameters:
+    // size_t index - bit index
+    // Output:
+    // Returns true if the bit is set
+    bool testBit(size_t index) const {
+        return (bits[index >> 6] >> (index & 63)) & 1ULL;
+    }
+
+    // Function: scanBits
+    // Parameters:
+    // size_t begin - first bit index (inclusive)
+    // size_t end - last bit index (exclusive)
+    // long long base - vertex id of bit 0 (vertex = base + bit index)
+    // F& visit - neighbor callback
+    // Output:
+    // Calls visit for every set bit in [begin, end) using
+    // count-trailing-zeros; returns false if visit asked to stop
+    template <typename F>
+    bool scanBits(size_t begin, size_t end, long long base, F& visit) const {
+        if (begin >= end) return true;
+
+        size_t firstWord = begin >> 6;
+        size_t lastWord = (end - 1) >> 6;
+
+        for (size_t w = firstWord; w <= lastWord; w++) {
+            uint64_t word = bits[w];
+            if (w == firstWord) word &= ~0ULL << (begin & 63);
+            if (w == lastWord && (end & 63) != 0) word &= ~0ULL >> (64 - (end & 63));
+
+            while (word != 0) {
+                size_t bit = (w << 6) + (size_t)__builtin_ctzll(word);
+                if (!callNeighborVisitor(visit, (int)(base + (long long)bit))) return false;
+                word &= word - 1;
+            }
+        }
+        return true;
+    }
+
+    // Function: findSetBit
+    // Parameters:
+    // size_t begin - first bit index (inclusive)
+    // size_t end - last bit index (exclusive)
+    // Output:
+    // Returns the index of the first set bit in [begin, end), or end
+    size_t findSetBit(size_t begin, size_t end) const {
+        while (begin < end) {
+            uint64_t word = bits[begin >> 6] & (~0ULL << (begin & 63));
+            if (word != 0) {
+                size_t bit = (begin & ~(size_t)63) + (size_t)__builtin_ctzll(word);
+                return bit < end ? bit : end;
+            }
+            begin = (begin | 63) + 1;
+        }
+        return end;
+    }
 
 public:
     // Function: MatrixGraph (Constructor)
     // Parameters:
     // int vertices - number of vertices
     // bool isDirected - directed flag
+    // bool upperTriangleOnly - store only u <= v cells (undirected only)
     // Output:
     // Constructs an empty adjacency matrix graph
-    MatrixGraph(int vertices, bool isDirected);
+    MatrixGraph(int vertices, bool isDirected, bool upperTriangleOnly = false);
 
     // Function: addEdge
     // Parameters:
@@ -47,6 +147,21 @@ public:
     // Returns true if edge is added successfully
     bool addEdge(int u, int v) override;
 
+    // Function: hasEdge
+    // Parameters:
+    // int u - source
+    // int v - destination
+    // Output:
+    // Returns true if edge u -> v exists (O(1))
+    bool hasEdge(int u, int v) const;
+
+    // Function: isUpperTriangleOnly
+    // Parameters:
+    // None
+    // Output:
+    // Returns true if only the u <= v half of the matrix is stored
+    bool isUpperTriangleOnly() const;
+
     // Function: display
     // Parameters:
     // None
@@ -75,6 +190,152 @@ public:
     // Returns vector of neighbors of u
     vector<int> getNeighbors(int u) const override;
 
+    // Function: forEachNeighbor
+    // Parameters:
+    // int u - vertex to query
+    // NeighborVisitor visit - callback receiving each neighbor
+    // Output:
+    // Calls visit(v) for every neighbor v of u without copying
+    void forEachNeighbor(int u, NeighborVisitor visit) const override;
+
+    // Function: forEachNeighbor (inline template)
+    // Parameters:
+    // int u - vertex to query
+    // F&& visit - callable taking a neighbor (may return bool to stop)
+    // Output:
+    // Same as the virtual version, but resolved at compile time so the
+    // callback can be inlined (used by the static algorithm layer)
+    // Notes:
+    // - Upper-triangle mode probes column u for v < u, then scans
+    //   the packed remainder of row u
+    template <typename F>
+    void forEachNeighbor(int u, F&& visit) const {
+        if (!isValidVertex(u)) return;
+
+        if (!upperTriangle) {
+            size_t rowStart = (size_t)u * wordsPerRow * 64;
+            scanBits(rowStart, rowStart + (size_t)V, -(long long)rowStart, visit);
+            return;
+        }
+
+        for (int v = 0; v < u; v++) {
+            if (testBit(bitIndex(v, u)) && !callNeighborVisitor(visit, v)) return;
+        }
+
+        size_t rowStart = triangleRowStart(u);
+        scanBits(rowStart, rowStart + (size_t)(V - u), (long long)u - (long long)rowStart, visit);
+    }
+
+    // Function: forEachWeightedNeighbor
+    // Parameters:
+    // int u - vertex to query
+    // WeightedNeighborVisitor visit - callback receiving (neighbor, weight)
+    // Output:
+    // Calls visit(v, 1) for every neighbor v of u (bit-packed cells carry no weights)
+    void forEachWeightedNeighbor(int u, WeightedNeighborVisitor visit) const override;
+
+    // Function: forEachWeightedNeighbor (inline template)
+    // Parameters:
+    // int u - vertex to query
+    // F&& visit - callable taking (neighbor, weight) (may return bool to stop)
+    // Output:
+    // Same as the virtual version, resolved at compile time
+    template <typename F>
+    void forEachWeightedNeighbor(int u, F&& visit) const {
+        forEachNeighbor(u, [&](int v) {
+            return callWeightedNeighborVisitor(visit, v, 1);
+        });
+    }
+
+    // Function: forEachInNeighbor
+    // Parameters:
+    // int u - vertex to query
+    // NeighborVisitor visit - callback receiving each in-neighbor
+    // Output:
+    // Calls visit(w) for every edge w -> u
+    // Notes:
+    // - Directed graphs probe column u (O(V))
+    void forEachInNeighbor(int u, NeighborVisitor visit) const override;
+
+    // Function: forEachInNeighbor (inline template)
+    // Parameters:
+    // int u - vertex to query
+    // F&& visit - callable taking an in-neighbor (may return bool to stop)
+    // Output:
+    // Same as the virtual version, resolved at compile time
+    template <typename F>
+    void forEachInNeighbor(int u, F&& visit) const {
+        if (!isValidVertex(u)) return;
+
+        if (!directed) {
+            forEachNeighbor(u, visit);
+            return;
+        }
+
+        for (int w = 0; w < V; w++) {
+            if (testBit(bitIndex(w, u)) && !callNeighborVisitor(visit, w)) return;
+        }
+    }
+
+    // Function: neighborCursor / inNeighborCursor
+    // Parameters:
+    // int u - vertex to query
+    // Output:
+    // Returns a cursor whose position is the next column to check
+    NeighborCursor neighborCursor(int u) const override {
+        NeighborCursor cursor;
+        cursor.vertex = u;
+        cursor.end = isValidVertex(u) ? V : 0;
+        return cursor;
+    }
+
+    NeighborCursor inNeighborCursor(int u) const override {
+        NeighborCursor cursor = neighborCursor(u);
+        cursor.incoming = directed;
+        return cursor;
+    }
+
+    // Function: nextNeighbor
+    // Parameters:
+    // NeighborCursor& cursor - cursor from neighborCursor / inNeighborCursor
+    // int& v - receives the next neighbor
+    // Output:
+    // Returns false once the row is exhausted
+    // Notes:
+    // - Packed runs of the row are skipped a word at a time; column
+    //   probes (in-neighbors, v < u in upper-triangle mode) check one
+    //   cell per column
+    bool nextNeighbor(NeighborCursor& cursor, int& v) const override {
+        int u = cursor.vertex;
+
+        while (cursor.position < cursor.end) {
+            int column = (int)cursor.position;
+
+            if (cursor.incoming || (upperTriangle && column < u)) {
+                cursor.position++;
+                if (testBit(bitIndex(column, u))) {
+                    v = column;
+                    return true;
+                }
+                continue;
+            }
+
+            // Remaining cells of row u are contiguous bits
+            size_t rowStart = upperTriangle ? triangleRowStart(u) - (size_t)u
+                                            : (size_t)u * wordsPerRow * 64;
+            size_t bit = findSetBit(rowStart + (size_t)column, rowStart + (size_t)V);
+            if (bit == rowStart + (size_t)V) {
+                cursor.position = cursor.end;
+                return false;
+            }
+
+            v = (int)(bit - rowStart);
+            cursor.position = v + 1;
+            return true;
+        }
+        return false;
+    }
+
     // Function: getOutDegree
     // Parameters:
     // int v - vertex
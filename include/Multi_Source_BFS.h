@@ -0,0 +1,80 @@
+//***************************************************************
+// File: Multi_Source_BFS.h
+// Description:
+//   Bit-parallel multi-source BFS (MS-BFS, Then et al.). Up to 64
+//   sources are searched together: every vertex keeps one 64-bit
+//   word each for seen / frontier / next, bit i standing for the
+//   i-th source of the batch, so one scan of an edge u -> v advances
+//   every search that has u on its frontier at once.
+//
+//   This module provides:
+//     - per-source distance arrays for a list of sources
+//     - per-source aggregated statistics (reached vertices, sum of
+//       distances, eccentricity) without storing the distances
+//
+// Notes:
+//   - Sources are processed in batches of 64; batches are handed to
+//     worker threads, each with its own bitmask arrays
+//   - Results are identical to one bfsShortestPaths call per source,
+//     for any thread count
+//***************************************************************
+
+#ifndef MULTI_SOURCE_BFS_H
+#define MULTI_SOURCE_BFS_H
+
+#include "IGraph.h"
+#include <vector>
+using namespace std;
+
+// Struct: MultiSourceBFSOptions
+// Purpose:
+//   Tuning knobs of the multi-source BFS.
+struct MultiSourceBFSOptions {
+    int threads = 0;    // 0 = hardware thread count (batches run in parallel)
+};
+
+// Struct: SourceDistanceStats
+// Purpose:
+//   Summary of the distances from one source.
+// Notes:
+//   - reached counts the source itself, so an isolated source has
+//     reached = 1, distanceSum = 0 and eccentricity = 0
+//   - Closeness centrality is (reached - 1) / distanceSum
+//   - An invalid source has reached = 0 and eccentricity = -1
+struct SourceDistanceStats {
+    int source = -1;
+    int reached = 0;            // vertices with a finite distance
+    long long distanceSum = 0;  // sum of those distances
+    int eccentricity = -1;      // largest finite distance
+};
+
+// Function: multiSourceBFSDistances
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// const vector<int>& sources - start vertices (duplicates allowed)
+// vector<vector<int>>& distances - output, distances[i][v] is the
+//   number of edges from sources[i] to v (-1 = unreachable)
+// const MultiSourceBFSOptions& options - thread count
+// Output:
+// Fills one distance array per source
+// Notes:
+// - An invalid source gets an all -1 row
+// - Needs sources.size() * V ints; use multiSourceBFSStats when only
+//   the aggregates are needed
+void multiSourceBFSDistances(const IGraph& graph,
+                             const vector<int>& sources,
+                             vector<vector<int>>& distances,
+                             const MultiSourceBFSOptions& options = MultiSourceBFSOptions());
+
+// Function: multiSourceBFSStats
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// const vector<int>& sources - start vertices (duplicates allowed)
+// const MultiSourceBFSOptions& options - thread count
+// Output:
+// Returns one SourceDistanceStats per source, in the order given
+vector<SourceDistanceStats> multiSourceBFSStats(const IGraph& graph,
+                                                const vector<int>& sources,
+                                                const MultiSourceBFSOptions& options = MultiSourceBFSOptions());
+
+#endif
@@ -0,0 +1,150 @@
+//***************************************************************
+// File: Multi_Source_BFS_Engine.h
+// Description:
+//   Bit-parallel BFS kernel shared by the multi-source BFS and the
+//   all-pairs distance engine. One call searches up to 64 sources
+//   together: every vertex keeps one 64-bit word each for seen /
+//   frontier / next, bit i standing for the i-th source of the batch.
+//
+// Per batch:
+//   1) seen[s] and visit[s] get the bit of every source s
+//   2) Per level, every frontier vertex u pushes its visit bits to
+//      each neighbor v: the bits not yet in seen[v] are new searches
+//      reaching v, and go to next[v] and seen[v]
+//   3) The vertices with a non-empty next word form the next frontier
+//
+// Notes:
+//   - The frontier is kept as a vertex list, so a level costs the
+//     edges of its frontier, not a scan of all V words
+//   - Every (source, vertex) pair is reported exactly once, at the
+//     level where the source's search first reaches the vertex
+//   - A workspace belongs to one thread and is reused across batches
+//***************************************************************
+
+#ifndef MULTI_SOURCE_BFS_ENGINE_H
+#define MULTI_SOURCE_BFS_ENGINE_H
+
+#include "IGraph.h"
+#include <vector>
+#include <cstdint>
+using namespace std;
+
+// Sources per batch (bits per mask word)
+const int MULTI_SOURCE_BATCH = 64;
+
+// Struct: MultiSourceBFSWorkspace
+// Purpose:
+//   Per-thread bitmask arrays and frontiers, reused across batches.
+struct MultiSourceBFSWorkspace {
+    vector<uint64_t> seen;
+    vector<uint64_t> visit;
+    vector<uint64_t> next;
+    vector<int> frontier;
+    vector<int> nextFrontier;
+    vector<int> touched;    // vertices with a non-zero seen word
+
+    // Function: reset
+    // Parameters:
+    // int V - number of vertices of the graph
+    // Output:
+    // Sizes the mask arrays for V vertices, all zero
+    void reset(int V) {
+        seen.assign(V, 0);
+        visit.assign(V, 0);
+        next.assign(V, 0);
+    }
+};
+
+// Function: forEachSetBit
+// Parameters:
+// uint64_t bits - mask to walk
+// F&& visit - callable visit(int bit)
+// Output:
+// Calls visit for every set bit, lowest first
+template <typename F>
+inline void forEachSetBit(uint64_t bits, F&& visit) {
+    while (bits != 0) {
+        visit(__builtin_ctzll(bits));
+        bits &= bits - 1;
+    }
+}
+
+// Function: runMultiSourceBatch
+// Parameters:
+// const G& graph - concrete graph type
+// const int* sources - first source of the batch
+// int count - number of sources in the batch (1..64)
+// MultiSourceBFSWorkspace& ws - worker arrays (after reset)
+// OnReach&& onReach - callable onReach(int v, uint64_t bits, int level)
+// Output:
+// Runs the batch; onReach(v, bits, level) reports that the searches
+// in bits reach v at distance level. Leaves the masks all zero again
+// Notes:
+// - Invalid sources are skipped (their bit is never reported)
+template <typename G, typename OnReach>
+void runMultiSourceBatch(const G& graph,
+                         const int* sources,
+                         int count,
+                         MultiSourceBFSWorkspace& ws,
+                         OnReach&& onReach) {
+    int V = graph.getVertexCount();
+    vector<uint64_t>& seen = ws.seen;
+    vector<uint64_t>& visit = ws.visit;
+    vector<uint64_t>& next = ws.next;
+    vector<int>& frontier = ws.frontier;
+    vector<int>& nextFrontier = ws.nextFrontier;
+    vector<int>& touched = ws.touched;
+
+    // 1) Seed the sources (invalid ones are skipped)
+    frontier.clear();
+    touched.clear();
+    for (int i = 0; i < count; i++) {
+        int s = sources[i];
+        if (s < 0 || s >= V) continue;
+
+        if (visit[s] == 0) frontier.push_back(s);
+        visit[s] |= 1ULL << i;
+        seen[s] |= 1ULL << i;
+    }
+    for (int s : frontier) {
+        onReach(s, visit[s], 0);
+        touched.push_back(s);
+    }
+
+    int level = 0;
+    while (!frontier.empty()) {
+        level++;
+        nextFrontier.clear();
+
+        // 2) Push frontier bits to the neighbors
+        for (int u : frontier) {
+            uint64_t bits = visit[u];
+            visit[u] = 0;
+
+            graph.forEachNeighbor(u, [&](int v) {
+                if (v < 0 || v >= V) return;
+
+                uint64_t fresh = bits & ~seen[v];
+                if (fresh == 0) return;
+
+                if (next[v] == 0) nextFrontier.push_back(v);
+                if (seen[v] == 0) touched.push_back(v);
+                next[v] |= fresh;
+                seen[v] |= fresh;
+            });
+        }
+
+        // 3) Report and promote the next frontier
+        for (int v : nextFrontier) {
+            onReach(v, next[v], level);
+            visit[v] = next[v];
+            next[v] = 0;
+        }
+
+        frontier.swap(nextFrontier);
+    }
+
+    for (int v : touched) seen[v] = 0;
+}
+
+#endif
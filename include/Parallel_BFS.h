@@ -0,0 +1,54 @@
+//***************************************************************
+// File: Parallel_BFS.h
+// Description:
+//   Multithreaded level-synchronous BFS. Each frontier is expanded
+//   by all workers at once; vertices are claimed with an atomic
+//   compare-and-swap on their distance and collected in per-thread
+//   next-frontier buffers.
+//
+// Determinism:
+//   - distance[v] is the BFS level, so it never depends on timing
+//   - parent[v] is the smallest-ID vertex of the previous level that
+//     has an edge to v (atomic minimum), so the same input always
+//     gives the same parent array, for any thread count
+//
+// Notes:
+//   - parent may differ from the sequential bfsShortestPaths, which
+//     keeps the first discoverer in queue order; both are valid
+//     shortest-path trees
+//   - Small frontiers are expanded on the calling thread only
+//***************************************************************
+
+#ifndef PARALLEL_BFS_H
+#define PARALLEL_BFS_H
+
+#include "IGraph.h"
+#include <vector>
+using namespace std;
+
+// Struct: ParallelBFSOptions
+// Purpose:
+//   Tuning knobs of the parallel BFS.
+struct ParallelBFSOptions {
+    int threads = 0;                // 0 = hardware thread count
+    int minParallelFrontier = 1024; // smaller frontiers stay sequential
+};
+
+// Function: parallelBFSShortestPaths
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - starting vertex
+// vector<int>& distance - output distances (-1 = unreachable)
+// vector<int>& parent - output parents (-1 = start / unreachable)
+// const ParallelBFSOptions& options - thread count and tuning
+// Output:
+// Fills distance and parent arrays using all worker threads
+// Notes:
+// - If start is invalid, distance and parent are cleared
+void parallelBFSShortestPaths(const IGraph& graph,
+                              int start,
+                              vector<int>& distance,
+                              vector<int>& parent,
+                              const ParallelBFSOptions& options = ParallelBFSOptions());
+
+#endif
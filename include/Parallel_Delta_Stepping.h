@@ -0,0 +1,78 @@
+//***************************************************************
+// File: Parallel_Delta_Stepping.h
+// Description:
+//   Multithreaded single-source shortest paths for graphs with
+//   non-negative edge weights (delta-stepping, Meyer & Sanders).
+//
+//   Tentative distances are grouped into buckets of width delta.
+//   The lowest non-empty bucket is emptied in phases: all of its
+//   vertices relax their light edges (weight <= delta) at once, which
+//   may put vertices back into the same bucket; once it stays empty,
+//   every vertex removed from it relaxes its heavy edges once.
+//   A small delta behaves like Dijkstra (little wasted work, little
+//   parallelism), a large one like Bellman-Ford.
+//
+// Determinism:
+//   - distance[v] is the exact shortest distance, for any delta and
+//     thread count
+//   - parent[v] is the smallest-ID vertex among the requests that
+//     set distance[v] in the same phase, so for a given delta the
+//     parent array does not depend on the thread count or timing
+//
+// Notes:
+//   - parent may differ from dijkstraShortestPaths, which keeps the
+//     first vertex that reached the final distance; both are valid
+//     shortest-path trees and work with reconstructPath
+//   - Unweighted graphs report weight 1 per edge, so delta = 1 makes
+//     the search a level-synchronous BFS
+//***************************************************************
+
+#ifndef PARALLEL_DELTA_STEPPING_H
+#define PARALLEL_DELTA_STEPPING_H
+
+#include "IGraph.h"
+#include <vector>
+using namespace std;
+
+// Struct: DeltaSteppingOptions
+// Purpose:
+//   Tuning knobs of the delta-stepping search.
+struct DeltaSteppingOptions {
+    int threads = 0;            // 0 = hardware thread count
+    EdgeWeight delta = 0;       // bucket width (0 = max weight / average degree)
+};
+
+// Struct: DeltaSteppingStats
+// Purpose:
+//   Work counters reported by deltaSteppingShortestPaths.
+struct DeltaSteppingStats {
+    EdgeWeight delta = 0;           // bucket width actually used
+    long long buckets = 0;          // non-empty buckets processed
+    long long phases = 0;           // light phases plus heavy steps
+    long long edgesInspected = 0;   // neighbor entries looked at
+    long long requests = 0;         // relax requests sent to owners
+};
+
+// Function: deltaSteppingShortestPaths
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - starting vertex
+// vector<EdgeWeight>& distance - output distances (-1 = unreachable)
+// vector<int>& parent - output parents (-1 = start / unreachable)
+// const DeltaSteppingOptions& options - thread count and bucket width
+// DeltaSteppingStats* stats - optional work counters (may be nullptr)
+// Output:
+// Fills distance and parent arrays using all worker threads
+// Notes:
+// - If start is invalid, distance and parent are cleared
+// - Negative weights are skipped, as in dijkstraShortestPaths
+// - At most 65536 buckets are live at once: delta is raised when the
+//   largest weight would need more (stats report the value used)
+void deltaSteppingShortestPaths(const IGraph& graph,
+                                int start,
+                                vector<EdgeWeight>& distance,
+                                vector<int>& parent,
+                                const DeltaSteppingOptions& options = DeltaSteppingOptions(),
+                                DeltaSteppingStats* stats = nullptr);
+
+#endif
@@ -0,0 +1,142 @@
+//***************************************************************
+// File: Parallel_Utils.h
+// Description:
+//   Small helpers for splitting work across std::thread workers.
+//   Shared by the bulk builder and the parallel algorithm modules.
+//
+// Notes:
+//   - Header-only; no thread pool, threads are spawned per call
+//   - The calling thread always runs chunk 0 itself
+//   - ThreadBarrier lets workers of one parallelForEachWorker call
+//     step through rounds together instead of respawning per round
+//***************************************************************
+
+#ifndef PARALLEL_UTILS_H
+#define PARALLEL_UTILS_H
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <mutex>
+#include <condition_variable>
+using namespace std;
+
+// Function: resolveThreadCount
+// Parameters:
+// int requested - requested worker count (0 or less = automatic)
+// Output:
+// Returns requested, or the hardware thread count (at least 1)
+inline int resolveThreadCount(int requested) {
+    if (requested > 0) return requested;
+    unsigned int hw = thread::hardware_concurrency();
+    return hw == 0 ? 1 : (int)hw;
+}
+
+// Function: parallelFor
+// Parameters:
+// long long begin - first index (inclusive)
+// long long end - last index (exclusive)
+// int threads - worker count (0 = automatic)
+// F&& body - callable body(int worker, long long lo, long long hi)
+// Output:
+// Splits [begin, end) into contiguous chunks, one per worker, and
+// runs body on each chunk concurrently; returns when all are done
+// Notes:
+// - Never starts more workers than there are indices
+template <typename F>
+void parallelFor(long long begin, long long end, int threads, F&& body) {
+    long long total = end - begin;
+    if (total <= 0) return;
+
+    int workers = (int)min<long long>(resolveThreadCount(threads), total);
+    if (workers == 1) {
+        body(0, begin, end);
+        return;
+    }
+
+    long long chunk = (total + workers - 1) / workers;
+    vector<thread> pool;
+    pool.reserve(workers - 1);
+
+    for (int w = 1; w < workers; w++) {
+        long long lo = begin + chunk * w;
+        long long hi = min(end, lo + chunk);
+        if (lo >= hi) break;
+        pool.emplace_back([&body, w, lo, hi]() { body(w, lo, hi); });
+    }
+
+    body(0, begin, min(end, begin + chunk));
+
+    for (thread& t : pool) t.join();
+}
+
+// Function: parallelForEachWorker
+// Parameters:
+// int threads - worker count (0 = automatic)
+// F&& body - callable body(int worker, int workerCount)
+// Output:
+// Runs body once on every worker concurrently and waits for all
+// Notes:
+// - Used when workers pull work dynamically (e.g. atomic counters)
+template <typename F>
+void parallelForEachWorker(int threads, F&& body) {
+    int workers = resolveThreadCount(threads);
+    if (workers == 1) {
+        body(0, 1);
+        return;
+    }
+
+    vector<thread> pool;
+    pool.reserve(workers - 1);
+    for (int w = 1; w < workers; w++) {
+        pool.emplace_back([&body, w, workers]() { body(w, workers); });
+    }
+
+    body(0, workers);
+
+    for (thread& t : pool) t.join();
+}
+
+// Class: ThreadBarrier
+// Purpose:
+//   Reusable barrier for a fixed number of workers. Everything a
+//   worker wrote before wait() is visible to all workers after it.
+class ThreadBarrier {
+private:
+    mutex lock;
+    condition_variable released;
+    int workers;
+    int waiting = 0;
+    long long generation = 0;
+
+public:
+    // Function: ThreadBarrier (Constructor)
+    // Parameters:
+    // int workers - number of workers that call wait() each round
+    // Output:
+    // Creates the barrier
+    explicit ThreadBarrier(int workers) : workers(workers) {}
+
+    // Function: wait
+    // Parameters:
+    // None
+    // Output:
+    // Blocks until all workers of the current round have arrived
+    // Notes:
+    // - Returns immediately for a single worker
+    void wait() {
+        if (workers <= 1) return;
+
+        unique_lock<mutex> guard(lock);
+        long long round = generation;
+        if (++waiting == workers) {
+            waiting = 0;
+            generation++;
+            released.notify_all();
+            return;
+        }
+        released.wait(guard, [&]() { return generation != round; });
+    }
+};
+
+#endif
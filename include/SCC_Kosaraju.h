@@ -13,6 +13,8 @@
 // Notes:
 //   - SCC is meaningful for directed graphs.
 //   - For undirected graphs, SCCs match connected components.
+//   - The second pass makes the graph build (and keep) its reverse
+//     adjacency; pearceSCC (SCC_Pearce.h) needs one forward pass only
 //***************************************************************
 
 #ifndef SCC_KOSARAJU_H
@@ -0,0 +1,60 @@
+//***************************************************************
+// File: SCC_Pearce.h
+// Description:
+//   Declares functions to find Strongly Connected Components (SCCs)
+//   in one depth-first pass, using Pearce's space-efficient variant
+//   of Tarjan's algorithm.
+//
+// Pearce's algorithm summary:
+//   1) Every vertex gets a DFS index when discovered; rindex[v] is
+//      lowered to the smallest index reachable from v's subtree
+//   2) A vertex whose rindex is still its own index when it finishes
+//      is the root of an SCC: it and every vertex above it on the
+//      component stack form the SCC
+//   3) Finished components get labels counted down from V - 1, so one
+//      int array holds both the indices and the final labels
+//
+// Compared to kosarajuSCC:
+//   - Follows out-edges only: no reverse adjacency is built (Kosaraju
+//     makes the graph cache a full transpose for its second pass)
+//   - One DFS pass instead of two, and no finish-order array
+//   - The label array doubles as rindex, so the extra memory is the
+//     DFS stack, the component stack and one root bit per vertex
+//
+// Notes:
+//   - SCC is meaningful for directed graphs.
+//   - For undirected graphs, SCCs match connected components.
+//   - Labels are a topological order of the condensation (an edge
+//     between two SCCs goes from the smaller label to the larger), as
+//     with kosarajuSCC; the two may number components differently
+//***************************************************************
+
+#ifndef SCC_PEARCE_H
+#define SCC_PEARCE_H
+
+#include "IGraph.h"
+#include <vector>
+using namespace std;
+
+// Function: pearceSCCLabels
+// Parameters:
+// const IGraph& graph - reference to a graph implementing IGraph
+// vector<int>& componentId - output array where componentId[v] is SCC index of v
+// Output:
+// Returns the number of SCCs
+// Notes:
+// - Labels only: use this when the member lists are not needed
+int pearceSCCLabels(const IGraph& graph, vector<int>& componentId);
+
+// Function: pearceSCC
+// Parameters:
+// const IGraph& graph - reference to a graph implementing IGraph
+// vector<int>& componentId - output array where componentId[v] is SCC index of v
+// Output:
+// Returns a list of SCCs, where each SCC is a vector of vertices
+// Notes:
+// - sccs[i] lists the vertices with componentId i in increasing order
+// - The lists are allocated at their final size from the labels
+vector<vector<int>> pearceSCC(const IGraph& graph, vector<int>& componentId);
+
+#endif
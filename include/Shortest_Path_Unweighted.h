@@ -7,6 +7,10 @@
 //     - distance array from a start vertex
 //     - parent array to reconstruct shortest paths
 //     - path reconstruction from start to target
+//     - direction-optimizing (top-down / bottom-up) BFS for large,
+//       low-diameter graphs
+//     - bidirectional BFS for single start -> target queries, with a
+//       reusable workspace for repeated lookups
 //
 // Notes:
 //   - Works with any IGraph implementation
@@ -36,6 +40,143 @@ void bfsShortestPaths(const IGraph& graph,
                       vector<int>& distance,
                       vector<int>& parent);
 
+// Struct: BFSDirectionOptions
+// Purpose:
+//   Switch points of the direction-optimizing BFS (Beamer et al.).
+// Notes:
+//   - Top-down -> bottom-up when the frontier's outgoing edges exceed
+//     (edges left to check from unvisited vertices) / alpha
+//   - Bottom-up -> top-down when the frontier shrinks below V / beta
+//   - Larger alpha switches to bottom-up earlier; larger beta stays
+//     bottom-up longer
+struct BFSDirectionOptions {
+    int alpha = 15;
+    int beta = 18;
+};
+
+// Struct: BFSTraversalStats
+// Purpose:
+//   Work counters reported by the direction-optimizing BFS.
+struct BFSTraversalStats {
+    long long edgesInspected = 0;   // neighbor entries looked at
+    int topDownSteps = 0;
+    int bottomUpSteps = 0;
+};
+
+// Function: bfsShortestPaths
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - starting vertex
+// vector<int>& distance - output distances from start
+// vector<int>& parent - output parents on a shortest path
+// const BFSDirectionOptions& options - switch points
+// BFSTraversalStats* stats - optional work counters (may be nullptr)
+// Output:
+// Fills distance and parent arrays, mixing top-down and bottom-up steps
+// Notes:
+// - distance is identical to the plain version
+// - parent[v] is always a vertex one level closer to start with an
+//   edge to v, but when several exist it may be a different one than
+//   the plain version picks (bottom-up stops at the first it finds)
+// - Bottom-up steps read in-neighbors (forEachInNeighbor), which
+//   builds the reverse adjacency of directed List/CSR/Compressed
+//   graphs on first use
+void bfsShortestPaths(const IGraph& graph,
+                      int start,
+                      vector<int>& distance,
+                      vector<int>& parent,
+                      const BFSDirectionOptions& options,
+                      BFSTraversalStats* stats = nullptr);
+
+// Struct: BidirectionalBFSOptions
+// Purpose:
+//   Limits of a bidirectional point-to-point query.
+struct BidirectionalBFSOptions {
+    int maxDistance = -1;   // give up beyond this many edges (-1 = no limit)
+};
+
+// Struct: BidirectionalBFSStats
+// Purpose:
+//   Work counters reported by a bidirectional query.
+struct BidirectionalBFSStats {
+    long long verticesVisited = 0;  // discovered by either side
+    long long edgesInspected = 0;   // neighbor entries looked at
+    int forwardSteps = 0;           // levels expanded from start
+    int backwardSteps = 0;          // levels expanded from target
+};
+
+// Struct: BidirectionalBFSWorkspace
+// Purpose:
+//   Per-vertex scratch arrays of bidirectionalShortestPath, kept
+//   between queries.
+// Notes:
+//   - A vertex belongs to the current query only if its stamp equals
+//     the query's stamp, so starting a query costs O(1) instead of a
+//     pass over all V entries
+//   - Resized automatically when used with a graph of another size
+//   - Not thread-safe: use one workspace per thread
+struct BidirectionalBFSWorkspace {
+    vector<unsigned int> forwardStamp;
+    vector<unsigned int> backwardStamp;
+    vector<int> forwardDistance;
+    vector<int> backwardDistance;
+    vector<int> forwardParent;      // previous vertex towards start
+    vector<int> backwardParent;     // next vertex towards target
+    vector<int> forwardFrontier;
+    vector<int> backwardFrontier;
+    vector<int> next;
+    unsigned int stamp = 0;
+
+    // Function: startQuery
+    // Parameters:
+    // int V - vertex count of the graph
+    // Output:
+    // Resizes the arrays if needed and returns the stamp of the new
+    // query; the stamp arrays are cleared only on resize and when
+    // the stamp wraps around
+    unsigned int startQuery(int V);
+};
+
+// Function: bidirectionalShortestPath
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - source vertex
+// int target - destination vertex
+// vector<int>& path - output, a shortest path start -> target (inclusive)
+// BidirectionalBFSWorkspace& workspace - scratch arrays reused across calls
+// const BidirectionalBFSOptions& options - distance limit
+// BidirectionalBFSStats* stats - optional work counters (may be nullptr)
+// Output:
+// Returns the distance in edges, or -1 (path cleared) if start or
+// target is invalid, target is unreachable, or it is farther than
+// options.maxDistance
+// Notes:
+// - Expands one full level at a time, always on the side with the
+//   smaller frontier; the backward side follows incoming edges
+// - Stops after the first level in which the two searches meet
+// - When several shortest paths exist, the one returned may differ
+//   from the bfsShortestPaths + reconstructPath one
+int bidirectionalShortestPath(const IGraph& graph,
+                              int start,
+                              int target,
+                              vector<int>& path,
+                              BidirectionalBFSWorkspace& workspace,
+                              const BidirectionalBFSOptions& options = BidirectionalBFSOptions(),
+                              BidirectionalBFSStats* stats = nullptr);
+
+// Function: bidirectionalShortestPath
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - source vertex
+// int target - destination vertex
+// vector<int>& path - output shortest path (inclusive)
+// Output:
+// Same as above with a temporary workspace (one-off queries)
+int bidirectionalShortestPath(const IGraph& graph,
+                              int start,
+                              int target,
+                              vector<int>& path);
+
 // Function: reconstructPath
 // Parameters:
 // int start - starting vertex
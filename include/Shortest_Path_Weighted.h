@@ -0,0 +1,87 @@
+//***************************************************************
+// File: Shortest_Path_Weighted.h
+// Description:
+//   Declares shortest path utilities for graphs with non-negative
+//   edge weights (Dijkstra's algorithm).
+//
+//   This module provides:
+//     - distance array from a start vertex (sum of edge weights)
+//     - parent array in the bfsShortestPaths layout, so
+//       reconstructPath (Shortest_Path_Unweighted.h) rebuilds paths
+//     - early exit at a target vertex or beyond a distance limit
+//     - a single start -> target query returning the path
+//
+// Notes:
+//   - Works with any IGraph implementation; unweighted graphs report
+//     weight 1 per edge, so distances then equal BFS distances
+//   - The priority queue is an indexed 4-ary heap with decrease-key
+//     (Indexed_DAry_Heap.h), so it never holds more than V entries
+//   - Weights are expected to be >= 0 (weighted graphs reject
+//     negative weights on insertion, and the search skips any it
+//     meets); path sums must fit in EdgeWeight
+//***************************************************************
+
+#ifndef SHORTEST_PATH_WEIGHTED_H
+#define SHORTEST_PATH_WEIGHTED_H
+
+#include "IGraph.h"
+#include <vector>
+using namespace std;
+
+// Struct: DijkstraOptions
+// Purpose:
+//   Optional stopping rules of dijkstraShortestPaths.
+struct DijkstraOptions {
+    int target = -1;                // stop once this vertex is settled (-1 = none)
+    EdgeWeight maxDistance = -1;    // ignore vertices farther than this (-1 = no limit)
+};
+
+// Struct: DijkstraStats
+// Purpose:
+//   Work counters reported by dijkstraShortestPaths.
+struct DijkstraStats {
+    long long settled = 0;          // vertices popped with a final distance
+    long long edgesInspected = 0;   // neighbor entries looked at
+    long long heapUpdates = 0;      // pushes plus decrease-keys
+};
+
+// Function: dijkstraShortestPaths
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - starting vertex
+// vector<EdgeWeight>& distance - output, distance[v] is the weight of a
+//                                lightest start -> v path
+// vector<int>& parent - output, parent[v] is the previous vertex on it
+// const DijkstraOptions& options - target / distance limit
+// DijkstraStats* stats - optional work counters (may be nullptr)
+// Output:
+// Fills distance and parent arrays
+// Notes:
+// - If start is invalid, distance and parent are cleared
+// - Unreached vertices have distance = -1 and parent = -1
+// - After an early stop only settled vertices keep a distance; the
+//   target (if reached) is always settled
+void dijkstraShortestPaths(const IGraph& graph,
+                           int start,
+                           vector<EdgeWeight>& distance,
+                           vector<int>& parent,
+                           const DijkstraOptions& options = DijkstraOptions(),
+                           DijkstraStats* stats = nullptr);
+
+// Function: dijkstraShortestPath
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - source vertex
+// int target - destination vertex
+// vector<int>& path - output, a lightest path start -> target (inclusive)
+// Output:
+// Returns the path weight, or -1 (path cleared) if start or target is
+// invalid or target is unreachable
+// Notes:
+// - Stops as soon as target is settled
+EdgeWeight dijkstraShortestPath(const IGraph& graph,
+                                int start,
+                                int target,
+                                vector<int>& path);
+
+#endif
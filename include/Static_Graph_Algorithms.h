@@ -0,0 +1,421 @@
+//***************************************************************
+// File: Static_Graph_Algorithms.h
+// Description:
+//   Template (static-dispatch) versions of the core algorithms.
+//   They run on any type that meets the graph concept below, so the
+//   compiler can inline neighbor iteration in the hot loops instead
+//   of making a virtual call per vertex.
+//
+// Graph concept (any type G providing):
+//   - int  getVertexCount() const
+//   - bool isDirected() const
+//   - void forEachNeighbor(int u, F visit) const
+//   - void forEachInNeighbor(int u, F visit) const
+//     where visit(int) may return void, or bool (false = stop)
+//   - neighborCursor / inNeighborCursor / nextNeighbor (DFS, see
+//     DFS_Engine.h)
+//
+// Notes:
+//   - ListGraph, MatrixGraph, CSRGraph and CompressedGraph provide
+//     inline template iteration and are explicitly instantiated in
+//     Static_Graph_Algorithms.cpp
+//   - IGraph itself also meets the concept (virtual fallback)
+//   - The IGraph& entry points in each module call these through
+//     dispatchGraph (Graph_Dispatch.h)
+//***************************************************************
+
+#ifndef STATIC_GRAPH_ALGORITHMS_H
+#define STATIC_GRAPH_ALGORITHMS_H
+
+#include "IGraph.h"
+#include "List_Implementation_Graph.h"
+#include "Matrix_Implementation_Graph.h"
+#include "CSR_Implementation_Graph.h"
+#include "Compressed_Implementation_Graph.h"
+#include "DFS_Engine.h"
+
+#include <vector>
+#include <queue>
+#include <algorithm>
+using namespace std;
+
+namespace StaticAlgorithms {
+
+namespace detail {
+
+// Struct: PreorderVisitor
+// Purpose:
+//   DFSEngine visitor collecting vertices in discovery order.
+struct PreorderVisitor : DFSVisitorBase {
+    vector<int> order;
+    void discoverVertex(int u, int) { order.push_back(u); }
+};
+
+// Struct: FinishOrderVisitor
+// Purpose:
+//   DFSEngine visitor collecting vertices in finishing order.
+struct FinishOrderVisitor : DFSVisitorBase {
+    vector<int> order;
+    void finishVertex(int u, int) { order.push_back(u); }
+};
+
+// Struct: DirectedCycleVisitor
+// Purpose:
+//   Stops at the first back edge (an edge into an open vertex).
+struct DirectedCycleVisitor : DFSVisitorBase {
+    bool backEdge(int, int) { return false; }
+};
+
+// Struct: UndirectedCycleVisitor
+// Purpose:
+//   Stops at the first edge to an already visited vertex, other than
+//   the edge back to the parent.
+// Notes:
+//   - An edge to a finished vertex can only reach a descendant, so it
+//     closes a cycle too (e.g. a second edge parallel to a tree edge)
+template <typename G>
+struct UndirectedCycleVisitor : DFSVisitorBase {
+    const DFSEngine<G>& dfs;
+    explicit UndirectedCycleVisitor(const DFSEngine<G>& engine) : dfs(engine) {}
+    bool backEdge(int u, int v) { return v == dfs.parentOf(u); }
+    bool forwardOrCrossEdge(int, int) { return false; }
+};
+
+} // namespace detail
+
+// Function: bfsOrder
+// Parameters:
+// const G& graph - graph meeting the concept
+// int start - starting vertex
+// Output:
+// Returns vertices in BFS visit order (empty if start is invalid)
+template <typename G>
+vector<int> bfsOrder(const G& graph, int start) {
+    int V = graph.getVertexCount();
+    vector<int> order;
+    if (start < 0 || start >= V) return order;
+
+    vector<bool> visited(V, false);
+    queue<int> q;
+
+    q.push(start);
+    visited[start] = true;
+
+    while (!q.empty()) {
+        int u = q.front();
+        q.pop();
+        order.push_back(u);
+
+        graph.forEachNeighbor(u, [&](int v) {
+            if (v < 0 || v >= V) return; // safety guard
+            if (!visited[v]) {
+                visited[v] = true;
+                q.push(v);
+            }
+        });
+    }
+    return order;
+}
+
+// Function: dfsOrder
+// Parameters:
+// const G& graph - graph meeting the concept
+// int start - starting vertex
+// Output:
+// Returns vertices in DFS preorder (empty if start is invalid)
+template <typename G>
+vector<int> dfsOrder(const G& graph, int start) {
+    int V = graph.getVertexCount();
+    if (start < 0 || start >= V) return vector<int>();
+
+    DFSEngine<G> dfs(graph);
+    detail::PreorderVisitor visitor;
+    dfs.run(start, visitor);
+    return move(visitor.order);
+}
+
+// Function: bfsShortestPaths
+// Parameters:
+// const G& graph - graph meeting the concept
+// int start - starting vertex
+// vector<int>& distance - output distances from start
+// vector<int>& parent - output parent pointers
+// Output:
+// Fills distance and parent arrays (cleared if start is invalid)
+template <typename G>
+void bfsShortestPaths(const G& graph, int start, vector<int>& distance, vector<int>& parent) {
+    int V = graph.getVertexCount();
+
+    if (V == 0 || start < 0 || start >= V) {
+        distance.clear();
+        parent.clear();
+        return;
+    }
+
+    distance.assign(V, -1);
+    parent.assign(V, -1);
+
+    queue<int> q;
+    q.push(start);
+    distance[start] = 0;
+
+    while (!q.empty()) {
+        int u = q.front();
+        q.pop();
+
+        graph.forEachNeighbor(u, [&](int v) {
+            if (v < 0 || v >= V) return;
+
+            // If v has not been visited, we found the shortest path to it
+            if (distance[v] == -1) {
+                distance[v] = distance[u] + 1;
+                parent[v] = u;
+                q.push(v);
+            }
+        });
+    }
+}
+
+// Function: hasCycle
+// Parameters:
+// const G& graph - graph meeting the concept
+// Output:
+// Returns true if graph contains a cycle
+template <typename G>
+bool hasCycle(const G& graph) {
+    int V = graph.getVertexCount();
+    DFSEngine<G> dfs(graph);
+
+    // Each visitor stops the search at the first cycle it finds
+    if (graph.isDirected()) {
+        detail::DirectedCycleVisitor visitor;
+        for (int i = 0; i < V; i++) {
+            if (!dfs.run(i, visitor)) return true;
+        }
+        return false;
+    }
+
+    detail::UndirectedCycleVisitor<G> visitor(dfs);
+    for (int i = 0; i < V; i++) {
+        if (!dfs.run(i, visitor)) return true;
+    }
+    return false;
+}
+
+// Function: topologicalSort
+// Parameters:
+// const G& graph - graph meeting the concept
+// vector<int>& order - output topological order
+// Output:
+// Returns true if a valid topological order exists (Kahn's algorithm)
+template <typename G>
+bool topologicalSort(const G& graph, vector<int>& order) {
+    int V = graph.getVertexCount();
+    order.clear();
+
+    // Topological sort is defined only for directed graphs
+    if (!graph.isDirected()) return false;
+
+    vector<int> indegree(V, 0);
+
+    // Compute in-degree of each vertex
+    for (int u = 0; u < V; u++) {
+        graph.forEachNeighbor(u, [&](int v) {
+            if (v < 0 || v >= V) return;
+            indegree[v]++;
+        });
+    }
+
+    queue<int> q;
+    for (int i = 0; i < V; i++) {
+        if (indegree[i] == 0) q.push(i);
+    }
+
+    while (!q.empty()) {
+        int u = q.front();
+        q.pop();
+
+        order.push_back(u);
+
+        graph.forEachNeighbor(u, [&](int v) {
+            if (v < 0 || v >= V) return;
+
+            indegree[v]--;
+            if (indegree[v] == 0) q.push(v);
+        });
+    }
+
+    // If not all vertices were processed, a cycle exists
+    return ((int)order.size() == V);
+}
+
+// Function: kosarajuSCC
+// Parameters:
+// const G& graph - graph meeting the concept
+// vector<int>& componentId - output mapping from vertex to SCC index
+// Output:
+// Returns SCC list (each SCC is a vector of vertices)
+template <typename G>
+vector<vector<int>> kosarajuSCC(const G& graph, vector<int>& componentId) {
+    int V = graph.getVertexCount();
+    componentId.assign(V, -1);
+
+    vector<vector<int>> sccs;
+    if (V == 0) return sccs;
+
+    // 1) DFS on original graph to compute finish order
+    DFSEngine<G> forward(graph);
+    detail::FinishOrderVisitor finish;
+    finish.order.reserve(V);
+
+    for (int i = 0; i < V; i++) forward.run(i, finish);
+
+    const vector<int>& order = finish.order;
+
+    // 2) DFS on reversed graph in reverse finish order
+    DFSEngine<G> backward(graph, true);
+    detail::PreorderVisitor collect;
+
+    int sccIndex = 0;
+    for (int idx = V - 1; idx >= 0; idx--) {
+        int start = order[idx];
+        if (backward.isVisited(start)) continue;
+
+        collect.order.clear();
+        backward.run(start, collect);
+
+        for (int v : collect.order) componentId[v] = sccIndex;
+
+        sccs.push_back(collect.order);
+        sccIndex++;
+    }
+
+    return sccs;
+}
+
+// Function: bipartiteColoring
+// Parameters:
+// const G& graph - graph meeting the concept
+// vector<int>& color - output color array (size V), values in {-1,0,1}
+// Output:
+// Returns true if bipartite, false if a conflict is found
+template <typename G>
+bool bipartiteColoring(const G& graph, vector<int>& color) {
+    int V = graph.getVertexCount();
+    color.assign(V, -1);
+
+    for (int start = 0; start < V; start++) {
+        if (color[start] != -1) continue;
+
+        queue<int> q;
+        q.push(start);
+        color[start] = 0;
+
+        bool conflict = false;
+
+        while (!q.empty() && !conflict) {
+            int u = q.front();
+            q.pop();
+
+            graph.forEachNeighbor(u, [&](int v) {
+                if (v < 0 || v >= V) return true; // safety guard
+
+                if (color[v] == -1) {
+                    color[v] = 1 - color[u];
+                    q.push(v);
+                } else if (color[v] == color[u]) {
+                    conflict = true;
+                }
+                return !conflict;
+            });
+        }
+
+        if (conflict) return false;
+    }
+
+    return true;
+}
+
+// Function: isConnected
+// Parameters:
+// const G& graph - graph meeting the concept
+// Output:
+// Returns true if graph is connected (weakly, for directed graphs)
+template <typename G>
+bool isConnected(const G& graph) {
+    int V = graph.getVertexCount();
+    if (V == 0) return true;
+
+    bool directed = graph.isDirected();
+    vector<bool> visited(V, false);
+    queue<int> q;
+
+    q.push(0);
+    visited[0] = true;
+
+    while (!q.empty()) {
+        int u = q.front();
+        q.pop();
+
+        auto visitNext = [&](int v) {
+            if (v < 0 || v >= V) return;
+            if (!visited[v]) {
+                visited[v] = true;
+                q.push(v);
+            }
+        };
+
+        graph.forEachNeighbor(u, visitNext);
+        if (directed) graph.forEachInNeighbor(u, visitNext);
+    }
+
+    for (bool seen : visited) {
+        if (!seen) return false;
+    }
+    return true;
+}
+
+// Explicit instantiations live in Static_Graph_Algorithms.cpp
+extern template vector<int> bfsOrder<ListGraph>(const ListGraph&, int);
+extern template vector<int> bfsOrder<MatrixGraph>(const MatrixGraph&, int);
+extern template vector<int> bfsOrder<CSRGraph>(const CSRGraph&, int);
+extern template vector<int> bfsOrder<CompressedGraph>(const CompressedGraph&, int);
+
+extern template vector<int> dfsOrder<ListGraph>(const ListGraph&, int);
+extern template vector<int> dfsOrder<MatrixGraph>(const MatrixGraph&, int);
+extern template vector<int> dfsOrder<CSRGraph>(const CSRGraph&, int);
+extern template vector<int> dfsOrder<CompressedGraph>(const CompressedGraph&, int);
+
+extern template void bfsShortestPaths<ListGraph>(const ListGraph&, int, vector<int>&, vector<int>&);
+extern template void bfsShortestPaths<MatrixGraph>(const MatrixGraph&, int, vector<int>&, vector<int>&);
+extern template void bfsShortestPaths<CSRGraph>(const CSRGraph&, int, vector<int>&, vector<int>&);
+extern template void bfsShortestPaths<CompressedGraph>(const CompressedGraph&, int, vector<int>&, vector<int>&);
+
+extern template bool hasCycle<ListGraph>(const ListGraph&);
+extern template bool hasCycle<MatrixGraph>(const MatrixGraph&);
+extern template bool hasCycle<CSRGraph>(const CSRGraph&);
+extern template bool hasCycle<CompressedGraph>(const CompressedGraph&);
+
+extern template bool topologicalSort<ListGraph>(const ListGraph&, vector<int>&);
+extern template bool topologicalSort<MatrixGraph>(const MatrixGraph&, vector<int>&);
+extern template bool topologicalSort<CSRGraph>(const CSRGraph&, vector<int>&);
+extern template bool topologicalSort<CompressedGraph>(const CompressedGraph&, vector<int>&);
+
+extern template vector<vector<int>> kosarajuSCC<ListGraph>(const ListGraph&, vector<int>&);
+extern template vector<vector<int>> kosarajuSCC<MatrixGraph>(const MatrixGraph&, vector<int>&);
+extern template vector<vector<int>> kosarajuSCC<CSRGraph>(const CSRGraph&, vector<int>&);
+extern template vector<vector<int>> kosarajuSCC<CompressedGraph>(const CompressedGraph&, vector<int>&);
+
+extern template bool bipartiteColoring<ListGraph>(const ListGraph&, vector<int>&);
+extern template bool bipartiteColoring<MatrixGraph>(const MatrixGraph&, vector<int>&);
+extern template bool bipartiteColoring<CSRGraph>(const CSRGraph&, vector<int>&);
+extern template bool bipartiteColoring<CompressedGraph>(const CompressedGraph&, vector<int>&);
+
+extern template bool isConnected<ListGraph>(const ListGraph&);
+extern template bool isConnected<MatrixGraph>(const MatrixGraph&);
+extern template bool isConnected<CSRGraph>(const CSRGraph&);
+extern template bool isConnected<CompressedGraph>(const CompressedGraph&);
+
+} // namespace StaticAlgorithms
+
+#endif
@@ -7,6 +7,8 @@
 // Notes:
 //   - Topological ordering exists only for directed acyclic graphs (DAGs)
 //   - If a cycle exists, no valid ordering is possible
+//   - For a DAG that grows edge by edge, DynamicTopologicalOrder
+//     (Dynamic_Topological_Order.h) keeps the order without re-sorting
 //***************************************************************
 
 #ifndef TOPOLOGICAL_SORT_H
@@ -0,0 +1,233 @@
+//***************************************************************
+// File: Union_Find.h
+// Description:
+//   Disjoint-set forests over vertex IDs.
+//
+// Classes:
+//   - UnionFind: single-threaded, union by size with path halving;
+//     used where edges arrive one at a time (incremental connectivity)
+//   - ConcurrentUnionFind: many threads may update it at once without
+//     locks (parallel connected components)
+//
+// ConcurrentUnionFind:
+//   Every set is a tree whose parent pointers always lead to a
+//   smaller ID, so the root of a set is its smallest member and the
+//   trees can never form a cycle, whatever the interleaving:
+//     - unite links the larger of two roots under the smaller one
+//       with a compare-and-swap, retrying if either root moved
+//     - find halves the path as it walks (each visited vertex is
+//       pointed at its grandparent)
+//
+// Example:
+//   ConcurrentUnionFind sets(V);
+//   parallelFor(0, V, 0, [&](int, long long lo, long long hi) {
+//       for (long long u = lo; u < hi; u++)
+//           graph.forEachNeighbor((int)u, [&](int v) { sets.unite((int)u, v); });
+//   });
+//   int root = sets.find(x);
+//
+// Notes:
+//   - Header-only; IDs must lie in [0, size())
+//   - UnionFind::connected does not compress, so const queries may
+//     run concurrently (trees stay O(log V) deep through union by size)
+//   - Only roots are ever swapped by unite, and path halving only
+//     stores ancestors into non-roots, so relaxed atomics suffice
+//***************************************************************
+
+#ifndef UNION_FIND_H
+#define UNION_FIND_H
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+using namespace std;
+
+// Class: UnionFind
+// Purpose:
+//   Sequential union-find with union by size and path halving; keeps
+//   the number of sets.
+class UnionFind {
+private:
+    vector<int> parent;
+    vector<int> setSize;
+    int sets = 0;
+
+    // Function: root
+    // Parameters:
+    // int v - element
+    // Output:
+    // Returns the root of v's set without changing the forest
+    int root(int v) const {
+        while (parent[v] != v) v = parent[v];
+        return v;
+    }
+
+public:
+    // Function: UnionFind (Constructor)
+    // Parameters:
+    // int count - number of elements (0..count-1), each its own set
+    // Output:
+    // Creates count singleton sets
+    explicit UnionFind(int count = 0) { reset(count); }
+
+    // Function: reset
+    // Parameters:
+    // int count - number of elements
+    // Output:
+    // Makes every element a singleton set again
+    void reset(int count) {
+        if (count < 0) count = 0;
+        parent.resize(count);
+        for (int i = 0; i < count; i++) parent[i] = i;
+        setSize.assign(count, 1);
+        sets = count;
+    }
+
+    // Function: size
+    // Parameters:
+    // None
+    // Output:
+    // Returns the number of elements
+    int size() const { return (int)parent.size(); }
+
+    // Function: setCount
+    // Parameters:
+    // None
+    // Output:
+    // Returns the number of disjoint sets, O(1)
+    int setCount() const { return sets; }
+
+    // Function: find
+    // Parameters:
+    // int v - element
+    // Output:
+    // Returns the root of v's set, halving the path on the way
+    int find(int v) {
+        while (parent[v] != v) {
+            parent[v] = parent[parent[v]];
+            v = parent[v];
+        }
+        return v;
+    }
+
+    // Function: unite
+    // Parameters:
+    // int u - element
+    // int v - element
+    // Output:
+    // Merges the sets of u and v; returns true if they were separate
+    bool unite(int u, int v) {
+        u = find(u);
+        v = find(v);
+        if (u == v) return false;
+
+        if (setSize[u] < setSize[v]) swap(u, v);
+        parent[v] = u;
+        setSize[u] += setSize[v];
+        sets--;
+        return true;
+    }
+
+    // Function: connected
+    // Parameters:
+    // int u - element
+    // int v - element
+    // Output:
+    // Returns true if u and v are in the same set, O(log n)
+    bool connected(int u, int v) const { return root(u) == root(v); }
+
+    // Function: sizeOf
+    // Parameters:
+    // int v - element
+    // Output:
+    // Returns the size of v's set
+    int sizeOf(int v) const { return setSize[root(v)]; }
+};
+
+// Class: ConcurrentUnionFind
+// Purpose:
+//   Lock-free union-find with path halving; roots are the smallest
+//   member of their set.
+class ConcurrentUnionFind {
+private:
+    int n;
+    unique_ptr<atomic<int>[]> parent;
+
+public:
+    // Function: ConcurrentUnionFind (Constructor)
+    // Parameters:
+    // int count - number of elements (0..count-1), each its own set
+    // Output:
+    // Creates count singleton sets
+    explicit ConcurrentUnionFind(int count)
+        : n(count > 0 ? count : 0), parent(new atomic<int>[count > 0 ? count : 0]) {
+        for (int i = 0; i < n; i++) parent[i].store(i, memory_order_relaxed);
+    }
+
+    // Function: size
+    // Parameters:
+    // None
+    // Output:
+    // Returns the number of elements
+    int size() const { return n; }
+
+    // Function: find
+    // Parameters:
+    // int v - element
+    // Output:
+    // Returns the root of v's set, halving the path on the way
+    int find(int v) {
+        while (true) {
+            int p = parent[v].load(memory_order_relaxed);
+            if (p == v) return v;
+
+            int grandparent = parent[p].load(memory_order_relaxed);
+            if (grandparent != p) parent[v].store(grandparent, memory_order_relaxed);
+            v = grandparent;
+        }
+    }
+
+    // Function: unite
+    // Parameters:
+    // int u - element
+    // int v - element
+    // Output:
+    // Merges the sets of u and v; returns true if they were separate
+    bool unite(int u, int v) {
+        while (true) {
+            u = find(u);
+            v = find(v);
+            if (u == v) return false;
+            if (u < v) swap(u, v);
+
+            // Link the larger root under the smaller; fails if another
+            // thread linked u first
+            int expected = u;
+            if (parent[u].compare_exchange_strong(expected, v, memory_order_relaxed)) return true;
+        }
+    }
+
+    // Function: compress
+    // Parameters:
+    // int v - element
+    // Output:
+    // Points v straight at its root
+    // Notes:
+    // - Safe to run on all elements in parallel once no unite is in
+    //   flight; afterwards parentOf(v) is v's root for every v
+    void compress(int v) {
+        parent[v].store(find(v), memory_order_relaxed);
+    }
+
+    // Function: parentOf
+    // Parameters:
+    // int v - element
+    // Output:
+    // Returns v's current parent (its root right after compress)
+    int parentOf(int v) const {
+        return parent[v].load(memory_order_relaxed);
+    }
+};
+
+#endif
@@ -0,0 +1,407 @@
+//***************************************************************
+// File: All_Pairs_Distances.cpp
+// Description:
+//   Implements the all-pairs distance engine and the matrix reader
+//   declared in All_Pairs_Distances.h.
+//
+// Writing:
+//   1) Create the file, reserve its full size and map it read-write
+//      (MAP_SHARED); the header goes in first with complete = 0
+//   2) Workers pull batches of 64 consecutive sources through an
+//      atomic counter; each batch owns rows [first, first + 64), so
+//      it first fills that block with the unreachable value and then
+//      stores every (source, vertex) pair the kernel reports
+//   3) msync the rows, then set complete = 1 and msync the header
+//
+// Notes:
+//   - Batches write disjoint row blocks, so workers need no locking
+//   - Each worker keeps one MultiSourceBFSWorkspace (3 words per
+//     vertex) for all of its batches
+//   - Uses POSIX open/posix_fallocate/mmap
+//***************************************************************
+
+#include "All_Pairs_Distances.h"
+#include "Graph_Dispatch.h"
+#include "Parallel_Utils.h"
+#include "Multi_Source_BFS_Engine.h"
+#include "Binary_File_Utils.h"
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <limits>
+#include <numeric>
+#include <cstring>
+#include <climits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+namespace {
+
+const char MATRIX_MAGIC[8] = {'G', 'R', 'A', 'P', 'H', 'A', 'P', 'D'};
+
+// Rows start on their own page, after the header
+const uint64_t ROWS_POSITION = 4096;
+
+// Struct: ProgressReporter
+// Purpose:
+//   Counts finished sources and calls the progress callback at most
+//   once per interval, from whichever worker notices it is due.
+struct ProgressReporter {
+    const AllPairsOptions& options;
+    long long total;
+    chrono::steady_clock::time_point start;
+    atomic<long long> done;
+    mutex lock;
+    double lastReport = 0;
+
+    ProgressReporter(const AllPairsOptions& o, long long sourcesTotal)
+        : options(o), total(sourcesTotal), start(chrono::steady_clock::now()), done(0) {}
+
+    // Function: elapsed
+    // Parameters:
+    // None
+    // Output:
+    // Returns the seconds since the reporter was created
+    double elapsed() const {
+        return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    }
+
+    // Function: report
+    // Parameters:
+    // long long finished - sources done so far
+    // double seconds - elapsed time
+    // Output:
+    // Calls the callback with a filled snapshot
+    void report(long long finished, double seconds) {
+        AllPairsProgress p;
+        p.sourcesDone = finished;
+        p.sourcesTotal = total;
+        p.elapsedSeconds = seconds;
+        p.sourcesPerSecond = seconds > 0 ? finished / seconds : 0;
+        p.remainingSeconds = p.sourcesPerSecond > 0 ? (total - finished) / p.sourcesPerSecond : 0;
+        options.progress(p);
+    }
+
+    // Function: batchDone
+    // Parameters:
+    // int count - sources finished by the caller
+    // Output:
+    // Adds count and reports if the interval has passed
+    // Notes:
+    // - A worker that finds another one reporting skips its turn
+    void batchDone(int count) {
+        long long finished = done.fetch_add(count, memory_order_relaxed) + count;
+        if (!options.progress) return;
+
+        unique_lock<mutex> guard(lock, try_to_lock);
+        if (!guard.owns_lock()) return;
+
+        double seconds = elapsed();
+        if (seconds - lastReport < options.progressInterval) return;
+        lastReport = seconds;
+        report(finished, seconds);
+    }
+};
+
+// Function: fillRows
+// Parameters:
+// const G& graph - concrete graph type
+// Entry* rows - first entry of row 0 (V * V entries)
+// const AllPairsOptions& options - thread count
+// ProgressReporter& reporter - progress accounting
+// AllPairsStats& stats - output pair counters
+// Output:
+// Writes every row of the matrix
+template <typename G, typename Entry>
+void fillRows(const G& graph,
+              Entry* rows,
+              const AllPairsOptions& options,
+              ProgressReporter& reporter,
+              AllPairsStats& stats) {
+    int V = graph.getVertexCount();
+    int batches = (V + MULTI_SOURCE_BATCH - 1) / MULTI_SOURCE_BATCH;
+    if (batches == 0) return;
+
+    const Entry unreachable = numeric_limits<Entry>::max();
+    const int limit = unreachable - 1;
+
+    vector<int> sources(V);
+    iota(sources.begin(), sources.end(), 0);
+
+    int workers = min(resolveThreadCount(options.threads), batches);
+    vector<long long> reached(workers, 0);
+    vector<long long> saturated(workers, 0);
+    atomic<int> nextBatch(0);
+
+    parallelForEachWorker(workers, [&](int worker, int) {
+        MultiSourceBFSWorkspace ws;
+        ws.reset(V);
+        long long myReached = 0;
+        long long mySaturated = 0;
+
+        while (true) {
+            int batch = nextBatch.fetch_add(1, memory_order_relaxed);
+            if (batch >= batches) break;
+
+            int first = batch * MULTI_SOURCE_BATCH;
+            int count = min(MULTI_SOURCE_BATCH, V - first);
+            Entry* block = rows + (size_t)first * V;
+            fill(block, block + (size_t)count * V, unreachable);
+
+            runMultiSourceBatch(graph, sources.data() + first, count, ws,
+                                [&](int v, uint64_t bits, int level) {
+                                    int n = __builtin_popcountll(bits);
+                                    myReached += n;
+                                    if (level >= limit) mySaturated += n;
+
+                                    Entry value = (Entry)min(level, limit);
+                                    forEachSetBit(bits, [&](int bit) {
+                                        block[(size_t)bit * V + v] = value;
+                                    });
+                                });
+
+            reporter.batchDone(count);
+        }
+
+        reached[worker] = myReached;
+        saturated[worker] = mySaturated;
+    });
+
+    for (int w = 0; w < workers; w++) {
+        stats.reachedPairs += reached[w];
+        stats.saturatedPairs += saturated[w];
+    }
+}
+
+} // namespace
+
+// Function: computeAllPairsDistances
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// const string& filename - output matrix file
+// const AllPairsOptions& options - entry width, threads, progress
+// AllPairsStats* stats - optional run summary
+// string* error - optional failure reason
+// Output:
+// Returns true if the complete matrix was written
+bool computeAllPairsDistances(const IGraph& graph,
+                              const string& filename,
+                              const AllPairsOptions& options,
+                              AllPairsStats* stats,
+                              string* error) {
+    int V = graph.getVertexCount();
+    if (options.entryBytes != 1 && options.entryBytes != 2) {
+        return fail(error, "entryBytes must be 1 or 2");
+    }
+
+    uint64_t rowBytes = (uint64_t)V * options.entryBytes;
+    uint64_t fileSize = ROWS_POSITION + rowBytes * V;
+
+    // 1) Create, reserve and map the file
+    int fd = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return fail(error, "cannot create " + filename);
+
+    int reserved = posix_fallocate(fd, 0, (off_t)fileSize);
+    if (reserved != 0) {
+        ::close(fd);
+        unlink(filename.c_str());
+        return fail(error, "cannot reserve " + to_string(fileSize) + " bytes for " + filename +
+                               " (" + strerror(reserved) + ")");
+    }
+
+    void* address = mmap(nullptr, (size_t)fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);  // the mapping stays valid after close
+    if (address == MAP_FAILED) {
+        unlink(filename.c_str());
+        return fail(error, "mmap failed for " + filename);
+    }
+    char* base = static_cast<char*>(address);
+
+    DistanceMatrixHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, MATRIX_MAGIC, sizeof(header.magic));
+    header.version = DISTANCE_MATRIX_VERSION;
+    header.flags = graph.isDirected() ? DISTANCE_MATRIX_FLAG_DIRECTED : 0;
+    header.vertexCount = V;
+    header.entryBytes = (uint32_t)options.entryBytes;
+    header.complete = 0;
+    header.rowsPosition = ROWS_POSITION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    memcpy(base, &header, sizeof(header));
+
+    // 2) Fill the rows
+    AllPairsStats local;
+    local.sources = V;
+    local.bytesWritten = (long long)(rowBytes * V);
+    ProgressReporter reporter(options, V);
+
+    dispatchGraph(graph, [&](const auto& g) {
+        if (options.entryBytes == 1) {
+            fillRows(g, reinterpret_cast<uint8_t*>(base + ROWS_POSITION), options, reporter, local);
+        } else {
+            fillRows(g, reinterpret_cast<uint16_t*>(base + ROWS_POSITION), options, reporter, local);
+        }
+    });
+
+    // 3) Flush the rows, then mark the file complete
+    bool flushed = msync(address, (size_t)fileSize, MS_SYNC) == 0;
+    if (flushed) {
+        header.complete = 1;
+        memcpy(base, &header, sizeof(header));
+        flushed = msync(address, sizeof(header), MS_SYNC) == 0;
+    }
+    munmap(address, (size_t)fileSize);
+    if (!flushed) return fail(error, "writing " + filename + " failed");
+
+    local.seconds = reporter.elapsed();
+    local.sourcesPerSecond = local.seconds > 0 ? V / local.seconds : 0;
+    if (options.progress) reporter.report(V, local.seconds);
+    if (stats) *stats = local;
+    return true;
+}
+
+// Function: printAllPairsProgress
+// Parameters:
+// const AllPairsProgress& progress - snapshot to print
+// Output:
+// Prints one progress line to stdout
+void printAllPairsProgress(const AllPairsProgress& progress) {
+    ostringstream line;
+    line << fixed << setprecision(1);
+    line << "  " << progress.sourcesDone << " / " << progress.sourcesTotal << " sources, "
+         << progress.sourcesPerSecond << " sources/s, "
+         << progress.elapsedSeconds << "s elapsed, "
+         << progress.remainingSeconds << "s left";
+    cout << line.str() << endl;
+}
+
+// Function: ~DistanceMatrix (Destructor)
+// Parameters:
+// None
+// Output:
+// Unmaps the file
+DistanceMatrix::~DistanceMatrix() {
+    close();
+}
+
+// Function: close
+// Parameters:
+// None
+// Output:
+// Unmaps the current file (if any) and resets the view
+void DistanceMatrix::close() {
+    if (mapping) munmap(mapping, mappingLength);
+    mapping = nullptr;
+    mappingLength = 0;
+    rows = nullptr;
+    V = 0;
+    entryBytes = 0;
+    directed = false;
+}
+
+// Function: open
+// Parameters:
+// const string& filename - matrix file
+// string* error - optional failure reason
+// Output:
+// Maps the file read-only after validating the header
+bool DistanceMatrix::open(const string& filename, string* error) {
+    close();
+
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return fail(error, "cannot open " + filename);
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        return fail(error, "cannot stat " + filename);
+    }
+
+    uint64_t fileSize = (uint64_t)info.st_size;
+    if (fileSize < sizeof(DistanceMatrixHeader)) {
+        ::close(fd);
+        return fail(error, "file too small for a matrix header");
+    }
+
+    void* address = mmap(nullptr, (size_t)fileSize, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);  // the mapping stays valid after close
+    if (address == MAP_FAILED) return fail(error, "mmap failed for " + filename);
+
+    DistanceMatrixHeader header;
+    memcpy(&header, address, sizeof(header));
+
+    string problem;
+    if (memcmp(header.magic, MATRIX_MAGIC, sizeof(header.magic)) != 0) {
+        problem = "not a distance matrix file (bad magic)";
+    } else if (header.byteOrder != BYTE_ORDER_MARK) {
+        problem = "file was written with a different byte order";
+    } else if (header.version != DISTANCE_MATRIX_VERSION) {
+        problem = "unsupported format version " + to_string(header.version);
+    } else if (header.vertexCount < 0 || header.vertexCount > INT_MAX ||
+               (header.entryBytes != 1 && header.entryBytes != 2)) {
+        problem = "invalid vertex count or entry width";
+    } else if (header.rowsPosition < sizeof(DistanceMatrixHeader) ||
+               header.rowsPosition > fileSize ||
+               (fileSize - header.rowsPosition) / header.entryBytes / max<int64_t>(1, header.vertexCount) <
+                   (uint64_t)header.vertexCount) {
+        problem = "rows exceed the file size";
+    } else if (header.complete != 1) {
+        problem = "matrix is incomplete (interrupted run)";
+    }
+
+    if (!problem.empty()) {
+        munmap(address, (size_t)fileSize);
+        return fail(error, problem);
+    }
+
+    mapping = address;
+    mappingLength = (size_t)fileSize;
+    rows = static_cast<const unsigned char*>(address) + header.rowsPosition;
+    V = (int)header.vertexCount;
+    entryBytes = (int)header.entryBytes;
+    directed = (header.flags & DISTANCE_MATRIX_FLAG_DIRECTED) != 0;
+    return true;
+}
+
+// Function: getVertexCount / getEntryBytes / isDirected
+// Parameters:
+// None
+// Output:
+// Returns the matrix dimensions and how it was computed
+int DistanceMatrix::getVertexCount() const { return V; }
+int DistanceMatrix::getEntryBytes() const { return entryBytes; }
+bool DistanceMatrix::isDirected() const { return directed; }
+
+// Function: saturationLimit
+// Parameters:
+// None
+// Output:
+// Returns 254 for 8-bit and 65534 for 16-bit matrices
+int DistanceMatrix::saturationLimit() const {
+    return entryBytes == 2 ? numeric_limits<uint16_t>::max() - 1
+                           : numeric_limits<uint8_t>::max() - 1;
+}
+
+// Function: distance
+// Parameters:
+// int s - source vertex
+// int t - target vertex
+// Output:
+// Returns the stored hop distance, or -1 if unreachable / invalid
+int DistanceMatrix::distance(int s, int t) const {
+    if (s < 0 || s >= V || t < 0 || t >= V) return -1;
+
+    size_t index = (size_t)s * V + t;
+    int value = entryBytes == 2 ? reinterpret_cast<const uint16_t*>(rows)[index]
+                                : rows[index];
+    return value > saturationLimit() ? -1 : value;
+}
@@ -9,13 +9,14 @@
 //   complexity relative to vertices and edges.
 //
 // Notes:
-//   - Designed for small to medium-sized graphs
+//   - Thin printing wrapper over breadthFirstTraversal
+//     (Graph_Traversal.h)
 //   - Works with both adjacency list and adjacency matrix graphs
 //***************************************************************
 
 #include "BFS_Traversal.h"
+#include "Graph_Traversal.h"
 #include <iostream>
-#include <queue>
 #include <vector>
 using namespace std;
 
@@ -33,28 +34,9 @@ void BFS(const IGraph& graph, int start) {
 
     if (start < 0 || start >= V) return;
 
-    vector<bool> visited(V, false);
-    queue<int> q;
-
-    q.push(start);
-    visited[start] = true;
+    TraversalResult result = breadthFirstTraversal(graph, start);
 
     cout << "BFS Traversal starting from vertex " << start << ": ";
-
-    while (!q.empty()) {
-        int u = q.front();
-        q.pop();
-
-        cout << u << " ";
-
-        for (int v : graph.getNeighbors(u)) {
-            if (v < 0 || v >= V) continue; // safety guard
-            if (!visited[v]) {
-                visited[v] = true;
-                q.push(v);
-            }
-        }
-    }
-
+    for (int u : result.order) cout << u << " ";
     cout << endl;
 }
@@ -0,0 +1,439 @@
+//***************************************************************
+// File: CSR_Implementation_Graph.cpp
+// Description:
+//   Implements a Compressed Sparse Row (CSR) graph that conforms to
+//   the IGraph interface. Construction uses a counting sort on the
+//   source vertex, so building is O(V + E) with no per-vertex
+//   allocations.
+//
+// Notes:
+//   - offsets/targets are two contiguous arrays, so neighbor scans
+//     are sequential memory reads (weights, when present, are a third
+//     array indexed like targets)
+//   - Undirected graphs store both (u,v) and (v,u), self-loops once
+//   - All reads go through rowOffsets/rowTargets, so owned and
+//     external (memory-mapped) storage behave identically
+//***************************************************************
+
+#include "CSR_Implementation_Graph.h"
+
+namespace {
+
+// Struct: OwnedRows
+// Purpose:
+//   Arrays of a built graph, shared read-only by the graph and its
+//   copies through sharedStorage.
+struct OwnedRows {
+    vector<long long> offsets;
+    vector<int> targets;
+    vector<EdgeWeight> weights;
+};
+
+} // namespace
+
+// Function: bindOwnedStorage
+// Parameters:
+// None
+// Output:
+// Moves the owned vectors into one shared read-only block and points
+// the row views at it
+// Notes:
+// - Copies of the graph share the block, so their views stay valid
+void CSRGraph::bindOwnedStorage() {
+    auto block = make_shared<OwnedRows>();
+    block->offsets = move(offsets);
+    block->targets = move(targets);
+    block->weights = move(weights);
+
+    rowOffsets = block->offsets.data();
+    rowTargets = block->targets.data();
+    rowWeights = weighted ? block->weights.data() : nullptr;
+    entryCount = (long long)block->targets.size();
+    sharedStorage = move(block);
+}
+
+// Function: buildFromEdges
+// Parameters:
+// const vector<pair<int, int>>& edges - edge list (u, v)
+// const vector<EdgeWeight>* edgeWeights - weight per edge, or nullptr
+// Output:
+// Fills offsets, targets, weights (if given) and inDegree
+// Notes:
+// - Pass 1 counts out-degrees, pass 2 turns them into offsets,
+//   pass 3 scatters targets. The scatter is stable, so each
+//   neighbor list keeps the edge-list order.
+void CSRGraph::buildFromEdges(const vector<pair<int, int>>& edges, const vector<EdgeWeight>* edgeWeights) {
+    offsets.assign(V + 1, 0);
+    vector<int> degrees(V, 0);
+
+    auto weightOf = [&](size_t i) -> EdgeWeight {
+        return (edgeWeights && i < edgeWeights->size()) ? (*edgeWeights)[i] : 1;
+    };
+
+    // 1) Count entries per source vertex
+    for (size_t i = 0; i < edges.size(); i++) {
+        int u = edges[i].first, v = edges[i].second;
+        if (!isValidVertex(u) || !isValidVertex(v) || weightOf(i) < 0) continue;
+
+        offsets[u + 1]++;
+        if (!directed && u != v) offsets[v + 1]++;
+    }
+
+    // 2) Prefix sum -> start offset of every row
+    for (int i = 0; i < V; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+
+    // 3) Scatter targets using a moving cursor per row
+    targets.assign(offsets[V], 0);
+    if (edgeWeights) weights.assign(offsets[V], 1);
+    vector<long long> cursor(offsets.begin(), offsets.end() - 1);
+
+    for (size_t i = 0; i < edges.size(); i++) {
+        int u = edges[i].first, v = edges[i].second;
+        EdgeWeight w = weightOf(i);
+        if (!isValidVertex(u) || !isValidVertex(v) || w < 0) continue;
+
+        if (edgeWeights) weights[cursor[u]] = w;
+        targets[cursor[u]++] = v;
+        degrees[v]++;
+
+        if (!directed && u != v) {
+            if (edgeWeights) weights[cursor[v]] = w;
+            targets[cursor[v]++] = u;
+            degrees[u]++;
+        }
+    }
+
+    inDegree.set(move(degrees));
+}
+
+// Function: CSRGraph (Constructor)
+// Parameters:
+// int vertices - number of vertices
+// bool isDirected - true if graph is directed, false if undirected
+// const vector<pair<int, int>>& edges - edge list (u, v)
+// Output:
+// Builds the packed graph from an edge list
+CSRGraph::CSRGraph(int vertices, bool isDirected, const vector<pair<int, int>>& edges)
+    : V(vertices),
+      directed(isDirected),
+      weighted(false) {
+    buildFromEdges(edges, nullptr);
+    bindOwnedStorage();
+}
+
+// Function: CSRGraph (Constructor)
+// Parameters:
+// int vertices - number of vertices
+// bool isDirected - true if graph is directed, false if undirected
+// const vector<pair<int, int>>& edges - edge list (u, v)
+// const vector<EdgeWeight>& edgeWeights - edgeWeights[i] weighs edges[i]
+// Output:
+// Builds the weighted packed graph from an edge list
+CSRGraph::CSRGraph(int vertices,
+                   bool isDirected,
+                   const vector<pair<int, int>>& edges,
+                   const vector<EdgeWeight>& edgeWeights)
+    : V(vertices),
+      directed(isDirected),
+      weighted(true) {
+    buildFromEdges(edges, &edgeWeights);
+    bindOwnedStorage();
+}
+
+// Function: CSRGraph (Constructor)
+// Parameters:
+// const ListGraph& graph - adjacency list graph to freeze
+// Output:
+// Copies every neighbor list of graph into the packed arrays
+// Notes:
+// - Rows are copied as stored, so undirected edges are not re-mirrored
+CSRGraph::CSRGraph(const ListGraph& graph)
+    : V(graph.getVertexCount()),
+      directed(graph.isDirected()),
+      weighted(graph.isWeighted()) {
+    offsets.assign(V + 1, 0);
+    vector<int> degrees(V, 0);
+
+    for (int u = 0; u < V; u++) {
+        offsets[u + 1] = offsets[u] + graph.getOutDegree(u);
+    }
+
+    targets.reserve(offsets[V]);
+    if (weighted) weights.reserve(offsets[V]);
+    for (int u = 0; u < V; u++) {
+        graph.forEachWeightedNeighbor(u, [&](int v, EdgeWeight w) {
+            targets.push_back(v);
+            if (weighted) weights.push_back(w);
+            degrees[v]++;
+        });
+    }
+
+    bindOwnedStorage();
+    inDegree.set(move(degrees));
+}
+
+// Function: ensureInDegree
+// Parameters:
+// None
+// Output:
+// Fills inDegree with one pass over the targets array
+// Notes:
+// - Undirected graphs never call this; their in-degree is the
+//   out-degree
+const vector<int>& CSRGraph::ensureInDegree() const {
+    return inDegree.get([this](vector<int>& degrees) {
+        degrees.assign(V, 0);
+        for (long long k = 0; k < entryCount; k++) {
+            degrees[rowTargets[k]]++;
+        }
+    });
+}
+
+// Function: ensureReverseAdjacency
+// Parameters:
+// None
+// Output:
+// Builds the transpose in CSR form: sources of edges into v are
+// sources[offsets[v] .. offsets[v + 1])
+// Notes:
+// - Offsets come straight from the in-degrees
+// - Sources are written in ascending order of u
+const CSRGraph::ReverseRows& CSRGraph::ensureReverseAdjacency() const {
+    return reverseRows.get([this](ReverseRows& rows) {
+        const vector<int>& degrees = ensureInDegree();
+
+        rows.offsets.assign(V + 1, 0);
+        for (int v = 0; v < V; v++) {
+            rows.offsets[v + 1] = rows.offsets[v] + degrees[v];
+        }
+
+        rows.sources.assign(rows.offsets[V], 0);
+        vector<long long> cursor(rows.offsets.begin(), rows.offsets.end() - 1);
+
+        for (int u = 0; u < V; u++) {
+            for (long long k = rowOffsets[u]; k < rowOffsets[u + 1]; k++) {
+                rows.sources[cursor[rowTargets[k]]++] = u;
+            }
+        }
+    });
+}
+
+// Function: CSRGraph (Constructor)
+// Parameters:
+// int vertices - number of vertices
+// bool isDirected - true if graph is directed, false if undirected
+// vector<long long>&& packedOffsets - offsets array (size V + 1)
+// vector<int>&& packedTargets - packed targets array
+// vector<int>&& inDegrees - in-degree of every vertex (may be empty)
+// Output:
+// Takes ownership of prebuilt arrays (no copy, no validation pass)
+CSRGraph::CSRGraph(int vertices,
+                   bool isDirected,
+                   vector<long long>&& packedOffsets,
+                   vector<int>&& packedTargets,
+                   vector<int>&& inDegrees)
+    : V(vertices),
+      directed(isDirected),
+      offsets(move(packedOffsets)),
+      targets(move(packedTargets)),
+      weighted(false) {
+    if ((int)inDegrees.size() == vertices) inDegree.set(move(inDegrees));
+    bindOwnedStorage();
+}
+
+// Function: CSRGraph (Constructor)
+// Parameters:
+// int vertices - number of vertices
+// bool isDirected - true if graph is directed, false if undirected
+// vector<long long>&& packedOffsets - offsets array (size V + 1)
+// vector<int>&& packedTargets - packed targets array
+// vector<EdgeWeight>&& packedWeights - weight of every target entry
+// vector<int>&& inDegrees - in-degree of every vertex (may be empty)
+// Output:
+// Takes ownership of prebuilt weighted arrays
+CSRGraph::CSRGraph(int vertices,
+                   bool isDirected,
+                   vector<long long>&& packedOffsets,
+                   vector<int>&& packedTargets,
+                   vector<EdgeWeight>&& packedWeights,
+                   vector<int>&& inDegrees)
+    : V(vertices),
+      directed(isDirected),
+      offsets(move(packedOffsets)),
+      targets(move(packedTargets)),
+      weights(move(packedWeights)),
+      weighted(true) {
+    if ((int)inDegrees.size() == vertices) inDegree.set(move(inDegrees));
+    weights.resize(targets.size(), 1);
+    bindOwnedStorage();
+}
+
+// Function: CSRGraph (Constructor)
+// Parameters:
+// int vertices - number of vertices
+// bool isDirected - true if graph is directed, false if undirected
+// const long long* offsetData - external offsets array (size V + 1)
+// const int* targetData - external targets array
+// shared_ptr<const void> storage - owner of the external block
+// const EdgeWeight* weightData - external weights, or nullptr
+// Output:
+// Views the external arrays; nothing is copied or scanned
+CSRGraph::CSRGraph(int vertices,
+                   bool isDirected,
+                   const long long* offsetData,
+                   const int* targetData,
+                   shared_ptr<const void> storage,
+                   const EdgeWeight* weightData)
+    : V(vertices),
+      directed(isDirected),
+      rowOffsets(offsetData),
+      rowTargets(targetData),
+      rowWeights(weightData),
+      entryCount(offsetData[vertices]),
+      weighted(weightData != nullptr),
+      sharedStorage(move(storage)) {}
+
+// Function: addEdge
+// Parameters:
+// int u - source vertex
+// int v - destination vertex
+// Output:
+// Always returns false
+// Notes:
+// - Build a ListGraph and freeze it again to change a CSR graph
+bool CSRGraph::addEdge(int u, int v) {
+    (void)u;
+    (void)v;
+    return false;
+}
+
+// Function: isWeighted
+// Parameters:
+// None
+// Output:
+// Returns true if the graph was built with edge weights
+bool CSRGraph::isWeighted() const {
+    return weighted;
+}
+
+// Function: display
+// Parameters:
+// None
+// Output:
+// Prints adjacency lists in the same style as ListGraph:
+//   u: v1 -> v2 -> ... -> NULL  (weighted: v(w))
+void CSRGraph::display() const {
+    cout << "Adjacency List (CSR):" << endl;
+
+    for (int i = 0; i < V; i++) {
+        cout << i << ": ";
+
+        for (long long k = rowOffsets[i]; k < rowOffsets[i + 1]; k++) {
+            cout << rowTargets[k];
+            if (rowWeights) cout << "(" << rowWeights[k] << ")";
+            cout << " -> ";
+        }
+
+        cout << "NULL" << endl;
+    }
+}
+
+// Function: getVertexCount
+// Parameters:
+// None
+// Output:
+// Returns the number of vertices in the graph
+int CSRGraph::getVertexCount() const {
+    return V;
+}
+
+// Function: isDirected
+// Parameters:
+// None
+// Output:
+// Returns true if graph is directed, false otherwise
+bool CSRGraph::isDirected() const {
+    return directed;
+}
+
+// Function: getNeighbors
+// Parameters:
+// int u - vertex to query
+// Output:
+// Returns a vector of neighbors of u (empty if u is invalid)
+vector<int> CSRGraph::getNeighbors(int u) const {
+    if (!isValidVertex(u)) return {};
+    return vector<int>(rowTargets + rowOffsets[u], rowTargets + rowOffsets[u + 1]);
+}
+
+// Function: forEachNeighbor
+// Parameters:
+// int u - vertex to query
+// NeighborVisitor visit - callback receiving each neighbor
+// Output:
+// Calls visit(v) for each entry of row u, stopping if it returns false
+// Notes:
+// - Delegates to the inline template version
+void CSRGraph::forEachNeighbor(int u, NeighborVisitor visit) const {
+    forEachNeighbor<NeighborVisitor&>(u, visit);
+}
+
+// Function: forEachWeightedNeighbor
+// Parameters:
+// int u - vertex to query
+// WeightedNeighborVisitor visit - callback receiving (neighbor, weight)
+// Output:
+// Calls visit(v, w) for each entry of row u, stopping if it returns false
+// Notes:
+// - Delegates to the inline template version
+void CSRGraph::forEachWeightedNeighbor(int u, WeightedNeighborVisitor visit) const {
+    forEachWeightedNeighbor<WeightedNeighborVisitor&>(u, visit);
+}
+
+// Function: forEachInNeighbor
+// Parameters:
+// int u - vertex to query
+// NeighborVisitor visit - callback receiving each in-neighbor
+// Output:
+// Calls visit(w) for every edge w -> u, stopping if it returns false
+// Notes:
+// - Undirected graphs are symmetric, so this reuses the forward rows
+// - Delegates to the inline template version
+void CSRGraph::forEachInNeighbor(int u, NeighborVisitor visit) const {
+    forEachInNeighbor<NeighborVisitor&>(u, visit);
+}
+
+// Function: getOutDegree
+// Parameters:
+// int v - vertex to query
+// Output:
+// Returns out-degree of v (0 if invalid)
+int CSRGraph::getOutDegree(int v) const {
+    if (!isValidVertex(v)) return 0;
+    return (int)(rowOffsets[v + 1] - rowOffsets[v]);
+}
+
+// Function: getInDegree
+// Parameters:
+// int v - vertex to query
+// Output:
+// Returns in-degree of v (0 if invalid)
+// Notes:
+// - Undirected graphs are symmetric, so in-degree = out-degree
+int CSRGraph::getInDegree(int v) const {
+    if (!isValidVertex(v)) return 0;
+    if (!directed) return getOutDegree(v);
+
+    return ensureInDegree()[v];
+}
+
+// Function: getEdgeEntryCount
+// Parameters:
+// None
+// Output:
+// Returns the number of stored adjacency entries
+long long CSRGraph::getEdgeEntryCount() const {
+    return entryCount;
+}
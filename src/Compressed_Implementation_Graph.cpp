@@ -0,0 +1,326 @@
+//***************************************************************
+// File: Compressed_Implementation_Graph.cpp
+// Description:
+//   Implements the gap + varint compressed graph declared in
+//   Compressed_Implementation_Graph.h.
+//
+// Notes:
+//   - Rows are encoded one at a time from the source graph
+//   - A weighted row is sorted as (neighbor, weight) pairs, so the
+//     weights of parallel edges come out in a fixed order
+//   - The reverse rows are built in blocks of target vertices, so the
+//     uncompressed scratch space stays bounded however large the
+//     graph is
+//***************************************************************
+
+#include "Compressed_Implementation_Graph.h"
+#include <algorithm>
+
+namespace {
+
+// Largest number of uncompressed entries held while building reverse rows
+const long long REVERSE_BLOCK_ENTRIES = 1LL << 26;
+
+// Function: appendVarint
+// Parameters:
+// vector<uint8_t>& out - destination buffer
+// uint64_t x - value to encode
+// Output:
+// Appends x using 7 bits per byte, least significant group first
+void appendVarint(vector<uint8_t>& out, uint64_t x) {
+    while (x >= 0x80) {
+        out.push_back((uint8_t)(x | 0x80));
+        x >>= 7;
+    }
+    out.push_back((uint8_t)x);
+}
+
+// Function: encodeRow
+// Parameters:
+// vector<uint8_t>& out - destination buffer
+// int u - owner of the row
+// const int* first - first neighbor (row sorted ascending)
+// const int* last - one past the last neighbor
+// Output:
+// Appends the encoded row (degree, first neighbor, gaps)
+void encodeRow(vector<uint8_t>& out, int u, const int* first, const int* last) {
+    appendVarint(out, (uint64_t)(last - first));
+    if (first == last) return;
+
+    long long delta = (long long)*first - u;
+    appendVarint(out, ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63));
+
+    for (const int* p = first + 1; p != last; ++p) {
+        appendVarint(out, (uint64_t)(*p - p[-1]));
+    }
+}
+
+} // namespace
+
+// Function: CompressedGraph (Constructor)
+// Parameters:
+// const IGraph& graph - graph to compress
+// Output:
+// Copies each row into a scratch buffer, sorts it, and encodes it
+// (and its weights, if graph is weighted)
+// Notes:
+// - Neighbors outside [0, V-1] are dropped
+CompressedGraph::CompressedGraph(const IGraph& graph)
+    : V(graph.getVertexCount()),
+      directed(graph.isDirected()),
+      weighted(graph.isWeighted()),
+      entryCount(0) {
+    rowStart.assign(V + 1, 0);
+    if (weighted) weightStart.assign(V + 1, 0);
+    vector<int> row;
+    vector<pair<int, EdgeWeight>> weightedRow;
+
+    for (int u = 0; u < V; u++) {
+        row.clear();
+        if (weighted) {
+            weightedRow.clear();
+            graph.forEachWeightedNeighbor(u, [&](int v, EdgeWeight w) {
+                if (isValidVertex(v)) weightedRow.emplace_back(v, w);
+            });
+            sort(weightedRow.begin(), weightedRow.end());
+
+            weightStart[u] = (long long)weightData.size();
+            for (const auto& entry : weightedRow) {
+                row.push_back(entry.first);
+                appendVarint(weightData, (uint64_t)entry.second);
+            }
+        } else {
+            graph.forEachNeighbor(u, [&](int v) {
+                if (isValidVertex(v)) row.push_back(v);
+            });
+            sort(row.begin(), row.end());
+        }
+
+        rowStart[u] = (long long)data.size();
+        encodeRow(data, u, row.data(), row.data() + row.size());
+        entryCount += (long long)row.size();
+    }
+
+    rowStart[V] = (long long)data.size();
+    data.shrink_to_fit();
+    if (weighted) {
+        weightStart[V] = (long long)weightData.size();
+        weightData.shrink_to_fit();
+    }
+}
+
+// Function: ensureReverseAdjacency
+// Parameters:
+// None
+// Output:
+// Encodes the transpose: row v lists every u with an edge u -> v
+// Notes:
+// - Pass 1 decodes all rows to count in-degrees
+// - Then, per block of targets holding at most REVERSE_BLOCK_ENTRIES
+//   entries, all rows are decoded again and only edges into the
+//   block are collected; sources arrive in ascending order, so the
+//   collected rows are already sorted
+const CompressedGraph::ReverseRows& CompressedGraph::ensureReverseAdjacency() const {
+    return reverseRows.get([this](ReverseRows& rows) {
+        vector<int> inDegree(V, 0);
+        for (int u = 0; u < V; u++) {
+            forEachNeighbor(u, [&](int v) { inDegree[v]++; });
+        }
+
+        rows.rowStart.assign(V + 1, 0);
+        rows.data.clear();
+
+        vector<long long> blockOffsets;
+        vector<int> blockSources;
+
+        int first = 0;
+        while (first < V) {
+            // Grow the block while it fits the budget (always at least one vertex)
+            int last = first;
+            long long entries = 0;
+            while (last < V && (last == first || entries + inDegree[last] <= REVERSE_BLOCK_ENTRIES)) {
+                entries += inDegree[last];
+                last++;
+            }
+
+            blockOffsets.assign(last - first + 1, 0);
+            for (int v = first; v < last; v++) {
+                blockOffsets[v - first + 1] = blockOffsets[v - first] + inDegree[v];
+            }
+            blockSources.assign(entries, 0);
+            vector<long long> cursor(blockOffsets.begin(), blockOffsets.end() - 1);
+
+            for (int u = 0; u < V; u++) {
+                forEachNeighbor(u, [&](int v) {
+                    if (v >= first && v < last) blockSources[cursor[v - first]++] = u;
+                });
+            }
+
+            for (int v = first; v < last; v++) {
+                rows.rowStart[v] = (long long)rows.data.size();
+                encodeRow(rows.data, v,
+                          blockSources.data() + blockOffsets[v - first],
+                          blockSources.data() + blockOffsets[v - first + 1]);
+            }
+
+            first = last;
+        }
+
+        rows.rowStart[V] = (long long)rows.data.size();
+        rows.data.shrink_to_fit();
+    });
+}
+
+// Function: addEdge
+// Parameters:
+// int u - source vertex
+// int v - destination vertex
+// Output:
+// Always returns false
+bool CompressedGraph::addEdge(int u, int v) {
+    (void)u;
+    (void)v;
+    return false;
+}
+
+// Function: display
+// Parameters:
+// None
+// Output:
+// Prints adjacency lists in the same style as ListGraph:
+//   u: v1 -> v2 -> ... -> NULL  (weighted: v(w))
+void CompressedGraph::display() const {
+    cout << "Adjacency List (Compressed):" << endl;
+
+    for (int i = 0; i < V; i++) {
+        cout << i << ": ";
+        forEachWeightedNeighbor(i, [&](int v, EdgeWeight w) {
+            cout << v;
+            if (weighted) cout << "(" << w << ")";
+            cout << " -> ";
+        });
+        cout << "NULL" << endl;
+    }
+}
+
+// Function: getVertexCount
+// Parameters:
+// None
+// Output:
+// Returns the number of vertices in the graph
+int CompressedGraph::getVertexCount() const {
+    return V;
+}
+
+// Function: isDirected
+// Parameters:
+// None
+// Output:
+// Returns true if graph is directed, false otherwise
+bool CompressedGraph::isDirected() const {
+    return directed;
+}
+
+// Function: isWeighted
+// Parameters:
+// None
+// Output:
+// Returns true if the graph carries a weight stream
+bool CompressedGraph::isWeighted() const {
+    return weighted;
+}
+
+// Function: getNeighbors
+// Parameters:
+// int u - vertex to query
+// Output:
+// Returns the decoded neighbors of u (empty if u is invalid)
+vector<int> CompressedGraph::getNeighbors(int u) const {
+    vector<int> result;
+    if (!isValidVertex(u)) return result;
+
+    result.reserve(getOutDegree(u));
+    forEachNeighbor(u, [&](int v) { result.push_back(v); });
+    return result;
+}
+
+// Function: forEachNeighbor
+// Parameters:
+// int u - vertex to query
+// NeighborVisitor visit - callback receiving each neighbor
+// Output:
+// Calls visit(v) for each neighbor of u, stopping if it returns false
+// Notes:
+// - Delegates to the inline template version
+void CompressedGraph::forEachNeighbor(int u, NeighborVisitor visit) const {
+    forEachNeighbor<NeighborVisitor&>(u, visit);
+}
+
+// Function: forEachWeightedNeighbor
+// Parameters:
+// int u - vertex to query
+// WeightedNeighborVisitor visit - callback receiving (neighbor, weight)
+// Output:
+// Calls visit(v, 1) for every neighbor v, stopping if it returns false
+// Notes:
+// - Delegates to the inline template version
+void CompressedGraph::forEachWeightedNeighbor(int u, WeightedNeighborVisitor visit) const {
+    forEachWeightedNeighbor<WeightedNeighborVisitor&>(u, visit);
+}
+
+// Function: forEachInNeighbor
+// Parameters:
+// int u - vertex to query
+// NeighborVisitor visit - callback receiving each in-neighbor
+// Output:
+// Calls visit(w) for every edge w -> u, stopping if it returns false
+// Notes:
+// - Delegates to the inline template version
+void CompressedGraph::forEachInNeighbor(int u, NeighborVisitor visit) const {
+    forEachInNeighbor<NeighborVisitor&>(u, visit);
+}
+
+// Function: getOutDegree
+// Parameters:
+// int v - vertex to query
+// Output:
+// Returns out-degree of v (0 if invalid)
+int CompressedGraph::getOutDegree(int v) const {
+    if (!isValidVertex(v)) return 0;
+    const uint8_t* p = data.data() + rowStart[v];
+    return (int)readVarint(p);
+}
+
+// Function: getInDegree
+// Parameters:
+// int v - vertex to query
+// Output:
+// Returns in-degree of v (0 if invalid)
+// Notes:
+// - Undirected graphs are symmetric, so in-degree = out-degree
+int CompressedGraph::getInDegree(int v) const {
+    if (!isValidVertex(v)) return 0;
+    if (!directed) return getOutDegree(v);
+
+    const ReverseRows& rows = ensureReverseAdjacency();
+    const uint8_t* p = rows.data.data() + rows.rowStart[v];
+    return (int)readVarint(p);
+}
+
+// Function: getEdgeEntryCount
+// Parameters:
+// None
+// Output:
+// Returns the number of stored adjacency entries
+long long CompressedGraph::getEdgeEntryCount() const {
+    return entryCount;
+}
+
+// Function: getEncodedBytes
+// Parameters:
+// None
+// Output:
+// Returns the size of the encoded forward rows and weights in bytes
+long long CompressedGraph::getEncodedBytes() const {
+    return (long long)(data.size() + weightData.size());
+}
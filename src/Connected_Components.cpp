@@ -0,0 +1,214 @@
+//***************************************************************
+// File: Connected_Components.cpp
+// Description:
+//   Implements the Afforest connected components decomposition
+//   declared in Connected_Components.h.
+//
+// Steps:
+//   - Sampling round r (r < samplingRounds): every vertex unites with
+//     its r-th neighbor, then every parent pointer is compressed
+//   - The giant component is the most frequent root among sampleSize
+//     vertices drawn with a fixed seed
+//   - Finish: every vertex (outside the giant component, for
+//     undirected graphs) unites with its neighbors past the first
+//     samplingRounds, then the pointers are compressed once more
+//
+// Notes:
+//   - Roots of ConcurrentUnionFind are the smallest member of their
+//     set, so after the last compression one ascending scan numbers
+//     the components by smallest vertex
+//   - Skipping the giant component is only sound when every edge is
+//     seen from both ends: an edge from a giant vertex to an outside
+//     vertex is then united from the outside end
+//   - Vertices are handed to workers in blocks through an atomic
+//     counter, since degrees can be very uneven
+//***************************************************************
+
+#include "Connected_Components.h"
+#include "Graph_Dispatch.h"
+#include "Parallel_Utils.h"
+#include "Union_Find.h"
+
+#include <atomic>
+#include <random>
+#include <algorithm>
+#include <unordered_map>
+using namespace std;
+
+namespace {
+
+// Vertices handed to a worker per atomic fetch
+const int VERTEX_BLOCK = 1024;
+
+// Function: forEachVertexBlock
+// Parameters:
+// int V - vertex count
+// int workers - worker count
+// F&& body - callable body(int u)
+// Output:
+// Runs body on every vertex, blocks of vertices pulled dynamically
+template <typename F>
+void forEachVertexBlock(int V, int workers, F&& body) {
+    atomic<int> nextBlock(0);
+
+    parallelForEachWorker(workers, [&](int, int) {
+        while (true) {
+            int lo = nextBlock.fetch_add(VERTEX_BLOCK, memory_order_relaxed);
+            if (lo >= V) break;
+
+            int hi = min(V, lo + VERTEX_BLOCK);
+            for (int u = lo; u < hi; u++) body(u);
+        }
+    });
+}
+
+// Function: compressAll
+// Parameters:
+// ConcurrentUnionFind& sets - union-find to flatten
+// int workers - worker count
+// Output:
+// Points every element straight at its root
+void compressAll(ConcurrentUnionFind& sets, int workers) {
+    parallelFor(0, sets.size(), workers, [&](int, long long lo, long long hi) {
+        for (long long v = lo; v < hi; v++) sets.compress((int)v);
+    });
+}
+
+// Function: mostFrequentRoot
+// Parameters:
+// const ConcurrentUnionFind& sets - compressed union-find
+// int sampleSize - vertices to draw
+// Output:
+// Returns the root seen most often among sampleSize random vertices
+// (the smallest such root on ties)
+int mostFrequentRoot(const ConcurrentUnionFind& sets, int sampleSize) {
+    int V = sets.size();
+    mt19937 generator(12345);
+    uniform_int_distribution<int> pick(0, V - 1);
+
+    unordered_map<int, int> seen;
+    for (int i = 0; i < max(1, sampleSize); i++) seen[sets.parentOf(pick(generator))]++;
+
+    int best = -1;
+    int bestCount = 0;
+    for (const auto& entry : seen) {
+        if (entry.second > bestCount || (entry.second == bestCount && entry.first < best)) {
+            best = entry.first;
+            bestCount = entry.second;
+        }
+    }
+    return best;
+}
+
+// Function: afforest
+// Parameters:
+// const G& graph - concrete graph type
+// ConcurrentUnionFind& sets - one singleton set per vertex on entry
+// int workers - worker count
+// int rounds - sampling rounds
+// int sampleSize - vertices drawn to find the giant component
+// Output:
+// Unites the endpoints of every edge and compresses the result
+template <typename G>
+void afforest(const G& graph, ConcurrentUnionFind& sets, int workers, int rounds, int sampleSize) {
+    int V = graph.getVertexCount();
+
+    for (int r = 0; r < rounds; r++) {
+        forEachVertexBlock(V, workers, [&](int u) {
+            int k = 0;
+            graph.forEachNeighbor(u, [&](int v) {
+                if (k++ < r) return true;
+                sets.unite(u, v);
+                return false;
+            });
+        });
+        compressAll(sets, workers);
+    }
+
+    int giant = mostFrequentRoot(sets, sampleSize);
+    bool skipGiant = !graph.isDirected();
+
+    forEachVertexBlock(V, workers, [&](int u) {
+        if (skipGiant && sets.find(u) == giant) return;
+
+        int k = 0;
+        graph.forEachNeighbor(u, [&](int v) {
+            if (k++ >= rounds) sets.unite(u, v);
+        });
+    });
+    compressAll(sets, workers);
+}
+
+// Function: buildSets
+// Parameters:
+// const IGraph& graph - graph to decompose
+// const ConnectedComponentsOptions& options - thread count and tuning
+// ConcurrentUnionFind& sets - one singleton set per vertex on entry
+// Output:
+// Runs afforest on the concrete graph type
+void buildSets(const IGraph& graph, const ConnectedComponentsOptions& options, ConcurrentUnionFind& sets) {
+    if (sets.size() == 0) return;
+
+    int workers = sets.size() < options.minParallelVertices ? 1 : resolveThreadCount(options.threads);
+    int rounds = max(0, options.samplingRounds);
+
+    dispatchGraph(graph, [&](const auto& g) {
+        afforest(g, sets, workers, rounds, options.sampleSize);
+    });
+}
+
+} // namespace
+
+// Function: findConnectedComponents
+// Parameters:
+// const IGraph& graph - reference to a graph implementing IGraph
+// const ConnectedComponentsOptions& options - thread count and tuning
+// Output:
+// Returns the labels, sizes and largest component of graph
+ConnectedComponents findConnectedComponents(const IGraph& graph,
+                                            const ConnectedComponentsOptions& options) {
+    int V = graph.getVertexCount();
+    ConcurrentUnionFind sets(V);
+    buildSets(graph, options, sets);
+
+    ConnectedComponents result;
+    result.componentId.assign(V, 0);
+
+    // A root precedes every other member of its set
+    for (int v = 0; v < V; v++) {
+        int root = sets.parentOf(v);
+        if (root == v) {
+            result.componentId[v] = (int)result.componentSize.size();
+            result.componentSize.push_back(0);
+        } else {
+            result.componentId[v] = result.componentId[root];
+        }
+        result.componentSize[result.componentId[v]]++;
+    }
+
+    for (int c = 0; c < result.count(); c++) {
+        if (result.largest == -1 || result.componentSize[c] > result.componentSize[result.largest]) {
+            result.largest = c;
+        }
+    }
+
+    return result;
+}
+
+// Function: countConnectedComponents
+// Parameters:
+// const IGraph& graph - reference to a graph implementing IGraph
+// const ConnectedComponentsOptions& options - thread count and tuning
+// Output:
+// Returns the number of connected components
+int countConnectedComponents(const IGraph& graph, const ConnectedComponentsOptions& options) {
+    int V = graph.getVertexCount();
+    ConcurrentUnionFind sets(V);
+    buildSets(graph, options, sets);
+
+    int count = 0;
+    for (int v = 0; v < V; v++) {
+        if (sets.parentOf(v) == v) count++;
+    }
+    return count;
+}
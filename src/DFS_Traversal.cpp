@@ -5,31 +5,16 @@
 //   that conforms to the IGraph interface.
 //
 // Notes:
-//   - Uses recursion (may not be ideal for extremely deep graphs)
+//   - Thin printing wrapper over depthFirstTraversal
+//     (Graph_Traversal.h), which uses an explicit stack
 //***************************************************************
 
 #include "DFS_Traversal.h"
+#include "Graph_Traversal.h"
 #include <iostream>
 #include <vector>
 using namespace std;
 
-// Function: DFS_Helper
-// Parameters:
-// const IGraph& graph - graph reference
-// int u - current vertex
-// vector<bool>& visited - visited tracking array
-// Output:
-// Prints DFS order as recursion explores neighbors
-static void DFS_Helper(const IGraph& graph, int u, vector<bool>& visited) {
-    visited[u] = true;
-    cout << u << " ";
-
-    for (int v : graph.getNeighbors(u)) {
-        if (v < 0 || v >= (int)visited.size()) continue;
-        if (!visited[v]) DFS_Helper(graph, v, visited);
-    }
-}
-
 // Function: DFS
 // Parameters:
 // const IGraph& graph - reference to any object implementing IGraph
@@ -44,9 +29,9 @@ void DFS(const IGraph& graph, int start) {
 
     if (start < 0 || start >= V) return;
 
-    vector<bool> visited(V, false);
+    TraversalResult result = depthFirstTraversal(graph, start);
 
     cout << "DFS Traversal starting from vertex " << start << ": ";
-    DFS_Helper(graph, start, visited);
+    for (int u : result.order) cout << u << " ";
     cout << endl;
 }
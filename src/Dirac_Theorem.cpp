@@ -22,17 +22,19 @@ using namespace std;
 static bool detectSimple_Dirac(const IGraph& g) {
     int n = g.getVertexCount();
 
-    for (int u = 0; u < n; u++) {
-        vector<int> nbrs = g.getNeighbors(u);
-        unordered_set<int> seen;
+    bool simple = true;
+    unordered_set<int> seen;
 
-        for (int v : nbrs) {
-            if (v == u) return false;         // self-loop
-            if (seen.count(v)) return false;  // parallel edge
-            seen.insert(v);
-        }
+    for (int u = 0; u < n && simple; u++) {
+        seen.clear();
+
+        g.forEachNeighbor(u, [&](int v) {
+            if (v == u) simple = false;                       // self-loop
+            else if (!seen.insert(v).second) simple = false;  // parallel edge
+            return simple;
+        });
     }
-    return true;
+    return simple;
 }
 
 // Function: analyzeDiracTheorem
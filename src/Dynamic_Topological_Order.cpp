@@ -0,0 +1,290 @@
+//***************************************************************
+// File: Dynamic_Topological_Order.cpp
+// Description:
+//   Implements the Pearce-Kelly dynamic topological order declared in
+//   Dynamic_Topological_Order.h.
+//
+// Notes:
+//   - Both searches are iterative (explicit stack) and mark vertices
+//     when they are pushed; a vertex can never be in both sets, since
+//     that would be a cycle through the new edge
+//   - via[] of the forward search forms a tree rooted at the head of
+//     the edge, so the rejected cycle is read back along it
+//   - A vertex outside [position(v), position(u)] cannot be on a path
+//     from v to u in a valid order, which is what bounds the searches
+//***************************************************************
+
+#include "Dynamic_Topological_Order.h"
+#include "Topological_Sort.h"
+
+#include <algorithm>
+using namespace std;
+
+// Function: DynamicTopologicalOrder (Constructor)
+// Parameters:
+// int vertices - number of vertices
+// Output:
+// Creates an edgeless DAG ordered by vertex ID
+DynamicTopologicalOrder::DynamicTopologicalOrder(int vertices)
+    : V(0), edges(0), stamp(0) {
+    reset(vertices);
+}
+
+// Function: reset
+// Parameters:
+// int vertices - number of vertices
+// Output:
+// Drops every edge; the order becomes 0, 1, ..., V-1
+void DynamicTopologicalOrder::reset(int vertices) {
+    V = max(0, vertices);
+    edges = 0;
+    out.assign(V, {});
+    in.assign(V, {});
+    ord.resize(V);
+    at.resize(V);
+    for (int v = 0; v < V; v++) ord[v] = at[v] = v;
+    mark.assign(V, 0);
+    stamp = 0;
+    via.assign(V, -1);
+}
+
+// Function: nextStamp
+// Parameters:
+// None
+// Output:
+// Advances stamp so that no vertex counts as visited
+void DynamicTopologicalOrder::nextStamp() {
+    stamp++;
+    if (stamp == 0) {
+        fill(mark.begin(), mark.end(), 0);
+        stamp = 1;
+    }
+}
+
+// Function: build
+// Parameters:
+// const IGraph& graph - directed graph to copy
+// Output:
+// Copies graph and takes Kahn's order as the starting order; returns
+// false if graph is undirected or cyclic
+bool DynamicTopologicalOrder::build(const IGraph& graph) {
+    reset(graph.getVertexCount());
+    if (!graph.isDirected()) return false;
+
+    vector<int> order;
+    if (!topologicalSort(graph, order)) return false;
+
+    for (int u = 0; u < V; u++) {
+        graph.forEachNeighbor(u, [&](int v) {
+            out[u].push_back(v);
+            in[v].push_back(u);
+            edges++;
+        });
+    }
+
+    for (int p = 0; p < V; p++) {
+        at[p] = order[p];
+        ord[order[p]] = p;
+    }
+    return true;
+}
+
+// Function: addVertex
+// Parameters:
+// None
+// Output:
+// Appends an isolated vertex (last in the order) and returns its ID
+int DynamicTopologicalOrder::addVertex() {
+    out.emplace_back();
+    in.emplace_back();
+    ord.push_back(V);
+    at.push_back(V);
+    mark.push_back(0);
+    via.push_back(-1);
+    return V++;
+}
+
+// Function: searchForward
+// Parameters:
+// int start - head of the new edge
+// int target - tail of the new edge
+// Output:
+// Fills forwardSet with the vertices reachable from start inside the
+// region; returns false (via[] then holds the path) on reaching target
+bool DynamicTopologicalOrder::searchForward(int start, int target) {
+    int upper = ord[target];
+    forwardSet.clear();
+    stack.assign(1, start);
+    mark[start] = stamp;
+    via[start] = -1;
+
+    while (!stack.empty()) {
+        int w = stack.back();
+        stack.pop_back();
+        forwardSet.push_back(w);
+
+        for (int x : out[w]) {
+            if (x == target) {
+                via[target] = w;
+                return false;
+            }
+            if (ord[x] < upper && mark[x] != stamp) {
+                mark[x] = stamp;
+                via[x] = w;
+                stack.push_back(x);
+            }
+        }
+    }
+    return true;
+}
+
+// Function: searchBackward
+// Parameters:
+// int start - tail of the new edge
+// int lower - position of the head of the new edge
+// Output:
+// Fills backwardSet with the vertices inside the region that reach start
+void DynamicTopologicalOrder::searchBackward(int start, int lower) {
+    backwardSet.clear();
+    stack.assign(1, start);
+    mark[start] = stamp;
+
+    while (!stack.empty()) {
+        int w = stack.back();
+        stack.pop_back();
+        backwardSet.push_back(w);
+
+        for (int x : in[w]) {
+            if (ord[x] > lower && mark[x] != stamp) {
+                mark[x] = stamp;
+                stack.push_back(x);
+            }
+        }
+    }
+}
+
+// Function: reorder
+// Parameters:
+// None
+// Output:
+// Reassigns the positions held by both sets: backwardSet first, then
+// forwardSet, each keeping its relative order
+void DynamicTopologicalOrder::reorder() {
+    auto byPosition = [this](int a, int b) { return ord[a] < ord[b]; };
+    sort(backwardSet.begin(), backwardSet.end(), byPosition);
+    sort(forwardSet.begin(), forwardSet.end(), byPosition);
+
+    positions.clear();
+    for (int w : backwardSet) positions.push_back(ord[w]);
+    for (int w : forwardSet) positions.push_back(ord[w]);
+    sort(positions.begin(), positions.end());
+
+    size_t next = 0;
+    for (int w : backwardSet) {
+        ord[w] = positions[next++];
+        at[ord[w]] = w;
+    }
+    for (int w : forwardSet) {
+        ord[w] = positions[next++];
+        at[ord[w]] = w;
+    }
+}
+
+// Function: addEdge
+// Parameters:
+// int u - source vertex
+// int v - destination vertex
+// vector<int>* cycle - optional output for a rejected edge
+// Output:
+// Returns true if u -> v was inserted (order repaired), false if a
+// vertex is invalid or the edge would close a cycle
+bool DynamicTopologicalOrder::addEdge(int u, int v, vector<int>* cycle) {
+    if (cycle) cycle->clear();
+    if (!isValidVertex(u) || !isValidVertex(v)) return false;
+
+    if (u == v) {
+        stats.edgesRejected++;
+        if (cycle) cycle->push_back(u);
+        return false;
+    }
+
+    int lower = ord[v];
+    if (lower < ord[u]) {
+        nextStamp();
+        if (!searchForward(v, u)) {
+            stats.edgesRejected++;
+            stats.verticesVisited += (long long)forwardSet.size();
+            if (cycle) {
+                for (int w = u; w != -1; w = via[w]) cycle->push_back(w);
+                reverse(cycle->begin(), cycle->end());
+            }
+            return false;
+        }
+
+        searchBackward(u, lower);
+        stats.verticesVisited += (long long)(forwardSet.size() + backwardSet.size());
+        stats.reorders++;
+        reorder();
+    }
+
+    out[u].push_back(v);
+    in[v].push_back(u);
+    edges++;
+    stats.edgesAdded++;
+    return true;
+}
+
+// Function: getVertexCount
+// Parameters:
+// None
+// Output:
+// Returns the number of vertices
+int DynamicTopologicalOrder::getVertexCount() const {
+    return V;
+}
+
+// Function: getEdgeCount
+// Parameters:
+// None
+// Output:
+// Returns the number of edges
+long long DynamicTopologicalOrder::getEdgeCount() const {
+    return edges;
+}
+
+// Function: getOrder
+// Parameters:
+// None
+// Output:
+// Returns the current topological order
+const vector<int>& DynamicTopologicalOrder::getOrder() const {
+    return at;
+}
+
+// Function: position
+// Parameters:
+// int v - vertex to query
+// Output:
+// Returns v's index in the order, -1 if invalid
+int DynamicTopologicalOrder::position(int v) const {
+    return isValidVertex(v) ? ord[v] : -1;
+}
+
+// Function: getNeighbors
+// Parameters:
+// int u - vertex to query
+// Output:
+// Returns the out-neighbors of u (empty if u is invalid)
+const vector<int>& DynamicTopologicalOrder::getNeighbors(int u) const {
+    static const vector<int> none;
+    return isValidVertex(u) ? out[u] : none;
+}
+
+// Function: getStats
+// Parameters:
+// None
+// Output:
+// Returns the running counters
+const DynamicTopologicalOrderStats& DynamicTopologicalOrder::getStats() const {
+    return stats;
+}
@@ -23,32 +23,18 @@
 //
 // Notes:
 //   - Designed for correctness and clarity
+//   - Directed connectivity uses the iterative DFSEngine in both
+//     directions (DFS_Engine.h)
 //   - Suitable for small to medium-sized graphs
 //***************************************************************
 
 #include "Euler_Theorem.h"
+#include "Graph_Dispatch.h"
+#include "DFS_Engine.h"
 #include <vector>
 #include <queue>
 using namespace std;
 
-// Function: buildReverseAdj
-// Parameters:
-// const IGraph& graph - reference to a directed graph
-// vector<vector<int>>& rev - output reverse adjacency list
-// Output:
-// Builds rev[v] = all vertices u such that u -> v exists
-static void buildReverseAdj(const IGraph& graph, vector<vector<int>>& rev) {
-    int V = graph.getVertexCount();
-    rev.assign(V, {});
-
-    for (int u = 0; u < V; u++) {
-        for (int v : graph.getNeighbors(u)) {
-            if (v < 0 || v >= V) continue;
-            rev[v].push_back(u);
-        }
-    }
-}
-
 // Function: firstNonIsolatedVertex
 // Parameters:
 // const IGraph& graph - graph reference
@@ -86,13 +72,13 @@ static bool nonIsolatedConnectedUndirected(const IGraph& graph) {
         int u = q.front();
         q.pop();
 
-        for (int v : graph.getNeighbors(u)) {
-            if (v < 0 || v >= V) continue;
+        graph.forEachNeighbor(u, [&](int v) {
+            if (v < 0 || v >= V) return;
             if (!visited[v]) {
                 visited[v] = true;
                 q.push(v);
             }
-        }
+        });
     }
 
     for (int i = 0; i < V; i++) {
@@ -103,34 +89,29 @@ static bool nonIsolatedConnectedUndirected(const IGraph& graph) {
     return true;
 }
 
-// Function: dfsDirectedWithOptionalExtraEdge
+// Function: reachWithOptionalExtraEdge
 // Parameters:
-// const vector<vector<int>>& adj - adjacency list
-// int u - current vertex
-// vector<bool>& visited - visited flags
+// DFSEngine<G>& dfs - engine over the graph (forward or incoming)
+// int start - first vertex
 // int extraFrom - virtual edge source (-1 if none)
 // int extraTo - virtual edge destination
 // Output:
-// Marks all reachable vertices in visited
-static void dfsDirectedWithOptionalExtraEdge(const vector<vector<int>>& adj,
-                                            int u,
-                                            vector<bool>& visited,
-                                            int extraFrom,
-                                            int extraTo) {
-    visited[u] = true;
-
-    for (int v : adj[u]) {
-        if (v < 0 || v >= (int)visited.size()) continue;
-        if (!visited[v]) {
-            dfsDirectedWithOptionalExtraEdge(adj, v, visited, extraFrom, extraTo);
-        }
-    }
+// Marks every vertex reachable from start in dfs, following the
+// virtual edge extraFrom -> extraTo as well
+// Notes:
+// - The virtual edge is a single edge, so one extra search from
+//   extraTo (once extraFrom is reached) completes the closure
+template <typename G>
+static void reachWithOptionalExtraEdge(DFSEngine<G>& dfs,
+                                       int start,
+                                       int extraFrom,
+                                       int extraTo) {
+    DFSVisitorBase markOnly;
+    dfs.run(start, markOnly);
 
     // Optional virtual edge (used for Euler path connectivity)
-    if (u == extraFrom && extraTo >= 0 && extraTo < (int)visited.size()) {
-        if (!visited[extraTo]) {
-            dfsDirectedWithOptionalExtraEdge(adj, extraTo, visited, extraFrom, extraTo);
-        }
+    if (extraFrom >= 0 && extraTo >= 0 && dfs.isVisited(extraFrom)) {
+        dfs.run(extraTo, markOnly);
     }
 }
 
@@ -149,31 +130,23 @@ static bool stronglyConnectedOnNonIsolated(const IGraph& graph,
 
     if (start == -1) return true;
 
-    vector<vector<int>> adj(V);
-    for (int u = 0; u < V; u++) {
-        for (int v : graph.getNeighbors(u)) {
-            if (v < 0 || v >= V) continue;
-            adj[u].push_back(v);
-        }
-    }
-
-    vector<vector<int>> rev;
-    buildReverseAdj(graph, rev);
-
-    vector<bool> visited1(V, false);
-    dfsDirectedWithOptionalExtraEdge(adj, start, visited1, extraFrom, extraTo);
+    return dispatchGraph(graph, [&](const auto& g) {
+        using G = typename decay<decltype(g)>::type;
 
-    vector<bool> visited2(V, false);
-    int revExtraFrom = (extraTo >= 0 ? extraTo : -1);
-    int revExtraTo   = (extraFrom >= 0 ? extraFrom : -1);
+        // Forward pass over outgoing edges
+        DFSEngine<G> forward(g);
+        reachWithOptionalExtraEdge(forward, start, extraFrom, extraTo);
 
-    dfsDirectedWithOptionalExtraEdge(rev, start, visited2, revExtraFrom, revExtraTo);
+        // Backward pass over incoming edges (virtual edge reversed too)
+        DFSEngine<G> backward(g, true);
+        reachWithOptionalExtraEdge(backward, start, extraTo, extraFrom);
 
-    for (int i = 0; i < V; i++) {
-        if (graph.getOutDegree(i) + graph.getInDegree(i) == 0) continue;
-        if (!visited1[i] || !visited2[i]) return false;
-    }
-    return true;
+        for (int i = 0; i < V; i++) {
+            if (graph.getOutDegree(i) + graph.getInDegree(i) == 0) continue;
+            if (!forward.isVisited(i) || !backward.isVisited(i)) return false;
+        }
+        return true;
+    });
 }
 
 // Function: hasEulerPathOrCircuit
@@ -6,14 +6,18 @@
 //
 // Notes:
 //   - Matrix is chosen for dense, non-dynamic graphs
-//   - List is chosen otherwise
+//   - CSR is chosen for sparse, non-dynamic graphs
+//   - List is chosen otherwise (dynamic graphs)
 //***************************************************************
 
 #include "GraphFactory.h"
 #include "List_Implementation_Graph.h"
 #include "Matrix_Implementation_Graph.h"
+#include "CSR_Implementation_Graph.h"
 
 #include <iostream>
+#include <vector>
+#include <utility>
 using namespace std;
 
 // Function: chooseGraphImplementation
@@ -27,6 +31,46 @@ static bool chooseMatrix(bool isDense, bool isDynamic) {
     return false;
 }
 
+// Function: chooseCSR
+// Parameters:
+// bool isDense - true if graph is dense
+// bool isDynamic - true if graph changes frequently
+// Output:
+// Returns true if the immutable CSR representation should be used
+static bool chooseCSR(bool isDense, bool isDynamic) {
+    return !isDense && !isDynamic;
+}
+
+// Function: readCSRGraph
+// Parameters:
+// int V - number of vertices
+// int E - number of edges to read
+// bool isDirected - directed flag
+// Output:
+// Reads E valid edges from standard input and returns a CSRGraph
+// Notes:
+// - CSR cannot grow edge by edge, so edges are validated and
+//   collected first, then packed in a single pass
+static IGraph* readCSRGraph(int V, int E, bool isDirected) {
+    vector<pair<int, int>> edges;
+    edges.reserve(E > 0 ? E : 0);
+
+    cout << "Enter edges (u v):" << endl;
+    for (int i = 0; i < E; i++) {
+        int u, v;
+        cin >> u >> v;
+
+        if (u < 0 || u >= V || v < 0 || v >= V) {
+            cout << "Invalid edge, re-enter" << endl;
+            i--;
+            continue;
+        }
+        edges.push_back({u, v});
+    }
+
+    return new CSRGraph(V, isDirected, edges);
+}
+
 // Function: selectAndCreateGraph
 // Parameters:
 // None
@@ -59,6 +103,11 @@ IGraph* selectAndCreateGraph() {
 
     IGraph* graph = nullptr;
 
+    if (chooseCSR(isDense, isDynamic)) {
+        cout << "Using compressed sparse row (CSR)" << endl;
+        return readCSRGraph(V, E, isDirected);
+    }
+
     if (chooseMatrix(isDense, isDynamic)) {
         cout << "Using adjacency matrix" << endl;
         graph = new MatrixGraph(V, isDirected);
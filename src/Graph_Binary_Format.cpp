@@ -0,0 +1,291 @@
+//***************************************************************
+// File: Graph_Binary_Format.cpp
+// Description:
+//   Implements the binary graph writer and the mmap-based loader
+//   declared in Graph_Binary_Format.h.
+//
+// Notes:
+//   - The writer streams offsets, targets and weights in fixed-size
+//     blocks
+//   - The loader maps the file read-only (MAP_SHARED) and hands the
+//     mapping to CSRGraph through a shared_ptr, so munmap happens
+//     when the graph is destroyed
+//   - Uses POSIX open/fstat/mmap
+//***************************************************************
+
+#include "Graph_Binary_Format.h"
+#include "Binary_File_Utils.h"
+
+#include <fstream>
+#include <vector>
+#include <cstring>
+#include <climits>
+#include <memory>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+namespace {
+
+const char BINARY_MAGIC[8] = {'G', 'R', 'A', 'P', 'H', 'C', 'S', 'R'};
+
+// Entries written per block by the writer
+const size_t WRITE_BLOCK = 1 << 16;
+
+// Struct: MappedFile
+// Purpose:
+//   Owns one read-only mapping; unmaps it on destruction.
+struct MappedFile {
+    void* address;
+    size_t length;
+
+    MappedFile(void* a, size_t n) : address(a), length(n) {}
+    ~MappedFile() { munmap(address, length); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+};
+
+// Function: weightsPositionAfter
+// Parameters:
+// uint64_t targetsPosition - byte position of the targets array
+// uint64_t entryCount - number of targets
+// Output:
+// Returns the 8-byte aligned position right after the targets array
+uint64_t weightsPositionAfter(uint64_t targetsPosition, uint64_t entryCount) {
+    uint64_t end = targetsPosition + sizeof(int32_t) * entryCount;
+    return (end + sizeof(int64_t) - 1) / sizeof(int64_t) * sizeof(int64_t);
+}
+
+} // namespace
+
+// Function: writeBinaryGraph
+// Parameters:
+// const IGraph& graph - graph of any representation
+// const string& filename - output file
+// bool withChecksum - store a checksum of the body
+// Output:
+// Returns true if the whole file was written, false otherwise
+// Notes:
+// - Offsets come from getOutDegree; the row scan must produce the
+//   same number of entries or the write is rejected
+bool writeBinaryGraph(const IGraph& graph, const string& filename, bool withChecksum) {
+    int V = graph.getVertexCount();
+    if (V < 0) return false;
+
+    ofstream out(filename, ios::binary | ios::trunc);
+    if (!out.is_open()) return false;
+
+    BinaryGraphHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, BINARY_MAGIC, sizeof(header.magic));
+    header.version = BINARY_GRAPH_VERSION;
+    bool weighted = graph.isWeighted();
+    header.flags = (graph.isDirected() ? BINARY_FLAG_DIRECTED : 0) |
+                   (withChecksum ? BINARY_FLAG_CHECKSUM : 0) |
+                   (weighted ? BINARY_FLAG_WEIGHTED : 0);
+    header.vertexCount = V;
+    header.offsetsPosition = sizeof(BinaryGraphHeader);
+    header.targetsPosition = header.offsetsPosition + sizeof(int64_t) * ((uint64_t)V + 1);
+    header.byteOrder = BYTE_ORDER_MARK;
+
+    // Placeholder header; rewritten once the counts and checksum are known
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    uint64_t hash = FNV_OFFSET_BASIS;
+
+    // 1) Offsets
+    vector<int64_t> offsetBlock;
+    offsetBlock.reserve(WRITE_BLOCK);
+
+    int64_t running = 0;
+    offsetBlock.push_back(0);
+    for (int u = 0; u < V; u++) {
+        running += graph.getOutDegree(u);
+        offsetBlock.push_back(running);
+
+        if (offsetBlock.size() == WRITE_BLOCK) {
+            size_t bytes = offsetBlock.size() * sizeof(int64_t);
+            if (withChecksum) hash = updateChecksum(hash, offsetBlock.data(), bytes);
+            out.write(reinterpret_cast<const char*>(offsetBlock.data()), bytes);
+            offsetBlock.clear();
+        }
+    }
+    if (!offsetBlock.empty()) {
+        size_t bytes = offsetBlock.size() * sizeof(int64_t);
+        if (withChecksum) hash = updateChecksum(hash, offsetBlock.data(), bytes);
+        out.write(reinterpret_cast<const char*>(offsetBlock.data()), bytes);
+    }
+
+    // 2) Targets
+    vector<int32_t> targetBlock;
+    targetBlock.reserve(WRITE_BLOCK);
+    int64_t written = 0;
+
+    for (int u = 0; u < V; u++) {
+        graph.forEachNeighbor(u, [&](int v) {
+            targetBlock.push_back(v);
+            if (targetBlock.size() == WRITE_BLOCK) {
+                size_t bytes = targetBlock.size() * sizeof(int32_t);
+                if (withChecksum) hash = updateChecksum(hash, targetBlock.data(), bytes);
+                out.write(reinterpret_cast<const char*>(targetBlock.data()), bytes);
+                written += (int64_t)targetBlock.size();
+                targetBlock.clear();
+            }
+        });
+    }
+    if (!targetBlock.empty()) {
+        size_t bytes = targetBlock.size() * sizeof(int32_t);
+        if (withChecksum) hash = updateChecksum(hash, targetBlock.data(), bytes);
+        out.write(reinterpret_cast<const char*>(targetBlock.data()), bytes);
+        written += (int64_t)targetBlock.size();
+    }
+
+    if (written != running) return false;
+
+    // 3) Weights, after zero padding up to 8 bytes
+    if (weighted) {
+        uint64_t targetsEnd = header.targetsPosition + sizeof(int32_t) * (uint64_t)running;
+        uint64_t padding = weightsPositionAfter(header.targetsPosition, (uint64_t)running) - targetsEnd;
+        const char zeros[sizeof(int64_t)] = {};
+        out.write(zeros, (streamsize)padding);
+
+        vector<int64_t> weightBlock;
+        weightBlock.reserve(WRITE_BLOCK);
+        int64_t weightsWritten = 0;
+
+        auto flushWeights = [&]() {
+            size_t bytes = weightBlock.size() * sizeof(int64_t);
+            if (withChecksum) hash = updateChecksum(hash, weightBlock.data(), bytes);
+            out.write(reinterpret_cast<const char*>(weightBlock.data()), bytes);
+            weightsWritten += (int64_t)weightBlock.size();
+            weightBlock.clear();
+        };
+
+        for (int u = 0; u < V; u++) {
+            graph.forEachWeightedNeighbor(u, [&](int, EdgeWeight w) {
+                weightBlock.push_back(w);
+                if (weightBlock.size() == WRITE_BLOCK) flushWeights();
+            });
+        }
+        if (!weightBlock.empty()) flushWeights();
+
+        if (weightsWritten != running) return false;
+    }
+
+    // 4) Final header
+    header.entryCount = running;
+    header.checksum = withChecksum ? hash : 0;
+
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.close();
+
+    return !out.fail();
+}
+
+// Function: loadBinaryGraph
+// Parameters:
+// const string& filename - binary graph file
+// BinaryLoadMode mode - Verify or TrustBody
+// string* error - optional message on failure (may be nullptr)
+// Output:
+// Returns a read-only CSRGraph viewing the mapped file, or nullptr
+CSRGraph* loadBinaryGraph(const string& filename, BinaryLoadMode mode, string* error) {
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return fail<CSRGraph*>(error, "cannot open " + filename);
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return fail<CSRGraph*>(error, "cannot stat " + filename);
+    }
+
+    uint64_t fileSize = (uint64_t)info.st_size;
+    if (fileSize < sizeof(BinaryGraphHeader)) {
+        close(fd);
+        return fail<CSRGraph*>(error, "file too small for a graph header");
+    }
+
+    void* address = mmap(nullptr, (size_t)fileSize, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);  // the mapping stays valid after close
+    if (address == MAP_FAILED) return fail<CSRGraph*>(error, "mmap failed for " + filename);
+
+    shared_ptr<MappedFile> mapping = make_shared<MappedFile>(address, (size_t)fileSize);
+    const char* base = static_cast<const char*>(address);
+
+    BinaryGraphHeader header;
+    memcpy(&header, base, sizeof(header));
+
+    // 1) Header checks
+    if (memcmp(header.magic, BINARY_MAGIC, sizeof(header.magic)) != 0) {
+        return fail<CSRGraph*>(error, "not a binary graph file (bad magic)");
+    }
+    if (header.byteOrder != BYTE_ORDER_MARK) {
+        return fail<CSRGraph*>(error, "file was written with a different byte order");
+    }
+    if (header.version < 1 || header.version > BINARY_GRAPH_VERSION) {
+        return fail<CSRGraph*>(error, "unsupported format version " + to_string(header.version));
+    }
+    if (header.vertexCount < 0 || header.vertexCount > INT_MAX || header.entryCount < 0) {
+        return fail<CSRGraph*>(error, "invalid vertex or entry count");
+    }
+
+    uint64_t V = (uint64_t)header.vertexCount;
+    uint64_t E = (uint64_t)header.entryCount;
+
+    if (header.offsetsPosition % sizeof(int64_t) != 0 ||
+        header.targetsPosition % sizeof(int32_t) != 0 ||
+        header.offsetsPosition < sizeof(BinaryGraphHeader) ||
+        header.offsetsPosition > fileSize ||
+        (fileSize - header.offsetsPosition) / sizeof(int64_t) < V + 1 ||
+        header.targetsPosition > fileSize ||
+        (fileSize - header.targetsPosition) / sizeof(int32_t) < E) {
+        return fail<CSRGraph*>(error, "sections exceed the file size");
+    }
+
+    bool weighted = (header.flags & BINARY_FLAG_WEIGHTED) != 0;
+    uint64_t weightsPosition = weightsPositionAfter(header.targetsPosition, E);
+    if (weighted && (weightsPosition > fileSize || (fileSize - weightsPosition) / sizeof(int64_t) < E)) {
+        return fail<CSRGraph*>(error, "weights section exceeds the file size");
+    }
+
+    const long long* offsets = reinterpret_cast<const long long*>(base + header.offsetsPosition);
+    const int* targets = reinterpret_cast<const int*>(base + header.targetsPosition);
+    const EdgeWeight* weights =
+        weighted ? reinterpret_cast<const EdgeWeight*>(base + weightsPosition) : nullptr;
+
+    // 2) Cheap consistency check: touches only the first and last page
+    if (offsets[0] != 0 || offsets[V] != header.entryCount) {
+        return fail<CSRGraph*>(error, "offsets do not match the entry count");
+    }
+
+    // 3) Full verification, unless the caller trusts the body
+    if (mode == BinaryLoadMode::Verify) {
+        if (header.flags & BINARY_FLAG_CHECKSUM) {
+            uint64_t hash = FNV_OFFSET_BASIS;
+            hash = updateChecksum(hash, offsets, sizeof(int64_t) * (V + 1));
+            hash = updateChecksum(hash, targets, sizeof(int32_t) * E);
+            if (weighted) hash = updateChecksum(hash, weights, sizeof(int64_t) * E);
+            if (hash != header.checksum) return fail<CSRGraph*>(error, "checksum mismatch");
+        }
+
+        for (uint64_t u = 0; u < V; u++) {
+            if (offsets[u] > offsets[u + 1]) return fail<CSRGraph*>(error, "offsets are not monotonic");
+        }
+        for (uint64_t k = 0; k < E; k++) {
+            if (targets[k] < 0 || (uint64_t)targets[k] >= V) {
+                return fail<CSRGraph*>(error, "target vertex out of range");
+            }
+        }
+        for (uint64_t k = 0; weighted && k < E; k++) {
+            if (weights[k] < 0) return fail<CSRGraph*>(error, "negative edge weight");
+        }
+    }
+
+    bool directed = (header.flags & BINARY_FLAG_DIRECTED) != 0;
+    return new CSRGraph((int)V, directed, offsets, targets, mapping, weights);
+}
@@ -11,7 +11,8 @@
 //***************************************************************
 
 #include "Graph_Bipartite.h"
-#include <queue>
+#include "Graph_Dispatch.h"
+#include "Static_Graph_Algorithms.h"
 using namespace std;
 
 // Function: buildBipartiteColoring
@@ -22,35 +23,11 @@ using namespace std;
 // Returns true if bipartite, false if conflict found
 // Notes:
 // - Uses BFS from each uncolored vertex (handles disconnected graphs)
+// - Coloring runs in StaticAlgorithms::bipartiteColoring
 static bool buildBipartiteColoring(const IGraph& graph, vector<int>& color) {
-    int V = graph.getVertexCount();
-    color.assign(V, -1);
-
-    for (int start = 0; start < V; start++) {
-        if (color[start] != -1) continue;
-
-        queue<int> q;
-        q.push(start);
-        color[start] = 0;
-
-        while (!q.empty()) {
-            int u = q.front();
-            q.pop();
-
-            for (int v : graph.getNeighbors(u)) {
-                if (v < 0 || v >= V) continue; // safety guard
-
-                if (color[v] == -1) {
-                    color[v] = 1 - color[u];
-                    q.push(v);
-                } else if (color[v] == color[u]) {
-                    return false;
-                }
-            }
-        }
-    }
-
-    return true;
+    return dispatchGraph(graph, [&](const auto& g) {
+        return StaticAlgorithms::bipartiteColoring(g, color);
+    });
 }
 
 // Function: isBipartite
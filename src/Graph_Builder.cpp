@@ -0,0 +1,474 @@
+//***************************************************************
+// File: Graph_Builder.cpp
+// Description:
+//   Implementation of the bulk graph builder (see Graph_Builder.h).
+//   Both CSR and list outputs share one row-building pipeline; the
+//   list builder just slices the finished rows into vectors.
+//
+// Notes:
+//   - Degree counters double as scatter cursors (filled back to front)
+//   - Weighted input carries a weight per edge through the same passes;
+//     rows are then sorted as (target, weight) pairs
+//   - Rows are handed out in small blocks through an atomic counter so
+//     a few huge hubs do not stall one worker
+//***************************************************************
+
+#include "Graph_Builder.h"
+#include "Parallel_Utils.h"
+#include <atomic>
+#include <algorithm>
+#include <memory>
+
+namespace {
+
+// Rows handed to a worker per atomic fetch in the row passes
+const int ROW_BLOCK = 1024;
+
+// Struct: EdgeSpan
+// Purpose:
+//   Read-only view of one edge buffer.
+struct EdgeSpan {
+    const pair<int, int>* data;
+    long long count;
+    const EdgeWeight* weights = nullptr;  // nullptr = unweighted input
+    long long weightCount = 0;            // edges past this get weight 1
+};
+
+// Struct: EdgeInput
+// Purpose:
+//   All edge buffers seen as one global index range.
+struct EdgeInput {
+    vector<EdgeSpan> spans;
+    vector<long long> starts;   // global index of each span's first edge
+    long long total = 0;
+    bool weighted = false;
+};
+
+// Function: makeInput
+// Parameters:
+// const vector<pair<int, int>>& edges - one edge array
+// const vector<EdgeWeight>* weights - weight per edge, or nullptr
+// Output:
+// Returns the array as a single-span input
+EdgeInput makeInput(const vector<pair<int, int>>& edges, const vector<EdgeWeight>* weights) {
+    EdgeInput input;
+    input.weighted = weights != nullptr;
+    if (edges.empty()) return input;
+
+    EdgeSpan span{edges.data(), (long long)edges.size()};
+    if (weights) {
+        span.weights = weights->data();
+        span.weightCount = min((long long)weights->size(), span.count);
+    }
+    input.spans.push_back(span);
+    input.starts.push_back(0);
+    input.total = (long long)edges.size();
+    return input;
+}
+
+// Function: makeInput
+// Parameters:
+// const vector<vector<pair<int, int>>>& buffers - edge buffers
+// Output:
+// Returns the buffers as one indexed input
+EdgeInput makeInput(const vector<vector<pair<int, int>>>& buffers) {
+    EdgeInput input;
+    for (const vector<pair<int, int>>& b : buffers) {
+        if (b.empty()) continue;
+        input.spans.push_back({b.data(), (long long)b.size()});
+        input.starts.push_back(input.total);
+        input.total += (long long)b.size();
+    }
+    return input;
+}
+
+// Function: forEachEdgeInRange
+// Parameters:
+// const EdgeInput& input - indexed edge buffers
+// long long lo - first global edge index (inclusive)
+// long long hi - last global edge index (exclusive)
+// F&& visit - callable visit(int u, int v, EdgeWeight w)
+// Output:
+// Calls visit for every edge in [lo, hi), crossing buffer boundaries
+// (w = 1 for unweighted input)
+template <typename F>
+void forEachEdgeInRange(const EdgeInput& input, long long lo, long long hi, F&& visit) {
+    size_t s = upper_bound(input.starts.begin(), input.starts.end(), lo) - input.starts.begin() - 1;
+    long long index = lo;
+
+    while (index < hi && s < input.spans.size()) {
+        const EdgeSpan& span = input.spans[s];
+        long long first = index - input.starts[s];
+        long long last = min(span.count, hi - input.starts[s]);
+        for (long long i = first; i < last; i++) {
+            EdgeWeight w = i < span.weightCount ? span.weights[i] : 1;
+            visit(span.data[i].first, span.data[i].second, w);
+        }
+        index = input.starts[s] + last;
+        s++;
+    }
+}
+
+// Function: forEachRowBlock
+// Parameters:
+// int vertices - number of rows
+// int threads - worker count
+// F&& body - callable body(int row)
+// Output:
+// Runs body on every row, workers pulling blocks dynamically
+template <typename F>
+void forEachRowBlock(int vertices, int threads, F&& body) {
+    atomic<int> next(0);
+    parallelForEachWorker(threads, [&](int, int) {
+        while (true) {
+            int start = next.fetch_add(ROW_BLOCK);
+            if (start >= vertices) break;
+            int stop = min(vertices, start + ROW_BLOCK);
+            for (int u = start; u < stop; u++) body(u);
+        }
+    });
+}
+
+// Function: addCounter
+// Parameters:
+// atomic<int>& counter - counter to update
+// int delta - amount to add
+// bool shared - true when other workers may touch the counter
+// Output:
+// Returns the previous value
+// Notes:
+// - A single worker skips the locked instruction; locked updates
+//   serialize the cache misses of these random-access passes
+inline int addCounter(atomic<int>& counter, int delta, bool shared) {
+    if (shared) return counter.fetch_add(delta, memory_order_relaxed);
+    int old = counter.load(memory_order_relaxed);
+    counter.store(old + delta, memory_order_relaxed);
+    return old;
+}
+
+// Struct: BuiltRows
+// Purpose:
+//   Output of the shared pipeline, in CSR layout.
+struct BuiltRows {
+    vector<long long> offsets;
+    vector<int> targets;
+    vector<EdgeWeight> weights;     // empty for unweighted input
+    vector<int> inDegree;
+};
+
+// Function: sortWeightedRow
+// Parameters:
+// int* targets - first target of the row
+// EdgeWeight* weights - first weight of the row
+// long long length - row length
+// bool deduplicate - keep only the lightest entry per target
+// Output:
+// Sorts the row by (target, weight); returns the kept length
+long long sortWeightedRow(int* targets, EdgeWeight* weights, long long length, bool deduplicate) {
+    if (length < 2) return length;
+
+    vector<pair<int, EdgeWeight>> entries(length);
+    for (long long i = 0; i < length; i++) entries[i] = {targets[i], weights[i]};
+    sort(entries.begin(), entries.end());
+
+    long long kept = 0;
+    for (long long i = 0; i < length; i++) {
+        if (deduplicate && kept > 0 && targets[kept - 1] == entries[i].first) continue;
+        targets[kept] = entries[i].first;
+        weights[kept] = entries[i].second;
+        kept++;
+    }
+    return kept;
+}
+
+// Function: buildRows
+// Parameters:
+// int vertices - number of vertices
+// const EdgeInput& input - indexed edge buffers
+// const GraphBuildOptions& options - build options
+// GraphBuildStats& stats - statistics to fill
+// Output:
+// Returns packed rows (and weights) plus in-degrees
+// Notes:
+// - Undirected edges are stored in both rows, self-loops once
+// - Negative weights count as invalid edges
+BuiltRows buildRows(int vertices,
+                    const EdgeInput& input,
+                    const GraphBuildOptions& options,
+                    GraphBuildStats& stats) {
+    BuiltRows rows;
+    int threads = resolveThreadCount(options.threads);
+    bool directed = options.directed;
+    bool dropSelfLoops = options.dropSelfLoops;
+    bool shared = threads > 1;
+    bool weighted = input.weighted;
+
+    stats = GraphBuildStats();
+    stats.inputEdges = input.total;
+
+    // 1) Degree count; also tallies what is dropped, per worker
+    unique_ptr<atomic<int>[]> count(new atomic<int>[vertices]);
+    for (int u = 0; u < vertices; u++) count[u].store(0, memory_order_relaxed);
+
+    vector<long long> invalid(threads, 0);
+    vector<long long> loops(threads, 0);
+
+    parallelFor(0, input.total, threads, [&](int worker, long long lo, long long hi) {
+        forEachEdgeInRange(input, lo, hi, [&](int u, int v, EdgeWeight w) {
+            if (u < 0 || u >= vertices || v < 0 || v >= vertices || w < 0) {
+                invalid[worker]++;
+                return;
+            }
+            if (u == v && dropSelfLoops) {
+                loops[worker]++;
+                return;
+            }
+            addCounter(count[u], 1, shared);
+            if (!directed && u != v) addCounter(count[v], 1, shared);
+        });
+    });
+
+    for (int w = 0; w < threads; w++) {
+        stats.invalidEdges += invalid[w];
+        stats.selfLoopsDropped += loops[w];
+    }
+
+    // 2) Prefix sum -> row offsets
+    rows.offsets.assign(vertices + 1, 0);
+    for (int u = 0; u < vertices; u++) {
+        rows.offsets[u + 1] = rows.offsets[u] + count[u].load(memory_order_relaxed);
+    }
+    rows.targets.resize(rows.offsets[vertices]);
+    if (weighted) rows.weights.resize(rows.offsets[vertices]);
+
+    // 3) Scatter; each counter walks its row from the back to the front
+    parallelFor(0, input.total, threads, [&](int, long long lo, long long hi) {
+        forEachEdgeInRange(input, lo, hi, [&](int u, int v, EdgeWeight w) {
+            if (u < 0 || u >= vertices || v < 0 || v >= vertices || w < 0) return;
+            if (u == v && dropSelfLoops) return;
+            long long slot = rows.offsets[u] + addCounter(count[u], -1, shared) - 1;
+            rows.targets[slot] = v;
+            if (weighted) rows.weights[slot] = w;
+            if (!directed && u != v) {
+                slot = rows.offsets[v] + addCounter(count[v], -1, shared) - 1;
+                rows.targets[slot] = u;
+                if (weighted) rows.weights[slot] = w;
+            }
+        });
+    });
+    count.reset();
+
+    // 4) Per-row sort / deduplication (weighted: lightest duplicate kept)
+    if (options.sortNeighbors || options.deduplicate) {
+        vector<int> kept;
+        if (options.deduplicate) kept.assign(vertices, 0);
+
+        forEachRowBlock(vertices, threads, [&](int u) {
+            int* first = rows.targets.data() + rows.offsets[u];
+            int* last = rows.targets.data() + rows.offsets[u + 1];
+            if (weighted) {
+                EdgeWeight* firstWeight = rows.weights.data() + rows.offsets[u];
+                int length = (int)sortWeightedRow(first, firstWeight, last - first, options.deduplicate);
+                if (options.deduplicate) kept[u] = length;
+                return;
+            }
+            sort(first, last);
+            if (options.deduplicate) kept[u] = (int)(unique(first, last) - first);
+        });
+
+        if (options.deduplicate) {
+            vector<long long> packed(vertices + 1, 0);
+            for (int u = 0; u < vertices; u++) packed[u + 1] = packed[u] + kept[u];
+
+            if (packed[vertices] != rows.offsets[vertices]) {
+                vector<int> compact(packed[vertices]);
+                vector<EdgeWeight> compactWeights(weighted ? packed[vertices] : 0);
+                forEachRowBlock(vertices, threads, [&](int u) {
+                    copy(rows.targets.begin() + rows.offsets[u],
+                         rows.targets.begin() + rows.offsets[u] + kept[u],
+                         compact.begin() + packed[u]);
+                    if (weighted) {
+                        copy(rows.weights.begin() + rows.offsets[u],
+                             rows.weights.begin() + rows.offsets[u] + kept[u],
+                             compactWeights.begin() + packed[u]);
+                    }
+                });
+                stats.duplicatesRemoved = rows.offsets[vertices] - packed[vertices];
+                rows.targets.swap(compact);
+                rows.weights.swap(compactWeights);
+                rows.offsets.swap(packed);
+            }
+        }
+    }
+
+    // In-degrees of the final rows
+    rows.inDegree.assign(vertices, 0);
+    if (directed) {
+        unique_ptr<atomic<int>[]> in(new atomic<int>[vertices]);
+        for (int u = 0; u < vertices; u++) in[u].store(0, memory_order_relaxed);
+
+        parallelFor(0, (long long)rows.targets.size(), threads, [&](int, long long lo, long long hi) {
+            for (long long i = lo; i < hi; i++) addCounter(in[rows.targets[i]], 1, shared);
+        });
+        for (int u = 0; u < vertices; u++) rows.inDegree[u] = in[u].load(memory_order_relaxed);
+    } else {
+        for (int u = 0; u < vertices; u++) {
+            rows.inDegree[u] = (int)(rows.offsets[u + 1] - rows.offsets[u]);
+        }
+    }
+
+    stats.storedEntries = (long long)rows.targets.size();
+    return rows;
+}
+
+// Function: buildCSRFromInput
+// Parameters:
+// int vertices - number of vertices
+// const EdgeInput& input - indexed edge buffers
+// const GraphBuildOptions& options - build options
+// GraphBuildStats* stats - optional output statistics
+// Output:
+// Returns a new CSRGraph adopting the built rows
+CSRGraph* buildCSRFromInput(int vertices,
+                            const EdgeInput& input,
+                            const GraphBuildOptions& options,
+                            GraphBuildStats* stats) {
+    GraphBuildStats local;
+    BuiltRows rows = buildRows(vertices, input, options, local);
+    if (stats) *stats = local;
+    if (input.weighted) {
+        return new CSRGraph(vertices, options.directed, move(rows.offsets), move(rows.targets),
+                            move(rows.weights), move(rows.inDegree));
+    }
+    return new CSRGraph(vertices, options.directed,
+                        move(rows.offsets), move(rows.targets), move(rows.inDegree));
+}
+
+// Function: buildListFromInput
+// Parameters:
+// int vertices - number of vertices
+// const EdgeInput& input - indexed edge buffers
+// const GraphBuildOptions& options - build options
+// GraphBuildStats* stats - optional output statistics
+// Output:
+// Returns a new ListGraph whose lists are copied out of the built rows
+ListGraph* buildListFromInput(int vertices,
+                              const EdgeInput& input,
+                              const GraphBuildOptions& options,
+                              GraphBuildStats* stats) {
+    GraphBuildStats local;
+    BuiltRows rows = buildRows(vertices, input, options, local);
+    if (stats) *stats = local;
+
+    vector<vector<int>> adjacency(vertices);
+    vector<vector<EdgeWeight>> weights(input.weighted ? vertices : 0);
+    forEachRowBlock(vertices, resolveThreadCount(options.threads), [&](int u) {
+        adjacency[u].assign(rows.targets.begin() + rows.offsets[u],
+                            rows.targets.begin() + rows.offsets[u + 1]);
+        if (input.weighted) {
+            weights[u].assign(rows.weights.begin() + rows.offsets[u],
+                              rows.weights.begin() + rows.offsets[u + 1]);
+        }
+    });
+
+    if (input.weighted) {
+        return new ListGraph(vertices, options.directed, move(adjacency), move(weights));
+    }
+    return new ListGraph(vertices, options.directed, move(adjacency));
+}
+
+} // namespace
+
+// Function: buildCSRGraph
+// Parameters:
+// int vertices - number of vertices
+// const vector<pair<int, int>>& edges - edge array (u, v)
+// const GraphBuildOptions& options - build options
+// GraphBuildStats* stats - optional output statistics (may be nullptr)
+// Output:
+// Returns a new CSRGraph built from edges
+CSRGraph* buildCSRGraph(int vertices,
+                        const vector<pair<int, int>>& edges,
+                        const GraphBuildOptions& options,
+                        GraphBuildStats* stats) {
+    return buildCSRFromInput(max(vertices, 0), makeInput(edges, nullptr), options, stats);
+}
+
+// Function: buildCSRGraph
+// Parameters:
+// int vertices - number of vertices
+// const vector<pair<int, int>>& edges - edge array (u, v)
+// const vector<EdgeWeight>& weights - weights[i] is the weight of edges[i]
+// const GraphBuildOptions& options - build options
+// GraphBuildStats* stats - optional output statistics (may be nullptr)
+// Output:
+// Returns a new weighted CSRGraph built from edges
+CSRGraph* buildCSRGraph(int vertices,
+                        const vector<pair<int, int>>& edges,
+                        const vector<EdgeWeight>& weights,
+                        const GraphBuildOptions& options,
+                        GraphBuildStats* stats) {
+    return buildCSRFromInput(max(vertices, 0), makeInput(edges, &weights), options, stats);
+}
+
+// Function: buildCSRGraph
+// Parameters:
+// int vertices - number of vertices
+// const vector<vector<pair<int, int>>>& edgeBuffers - per-thread edge buffers
+// const GraphBuildOptions& options - build options
+// GraphBuildStats* stats - optional output statistics (may be nullptr)
+// Output:
+// Returns a new CSRGraph built from all buffers (no merge copy)
+CSRGraph* buildCSRGraph(int vertices,
+                        const vector<vector<pair<int, int>>>& edgeBuffers,
+                        const GraphBuildOptions& options,
+                        GraphBuildStats* stats) {
+    return buildCSRFromInput(max(vertices, 0), makeInput(edgeBuffers), options, stats);
+}
+
+// Function: buildListGraph
+// Parameters:
+// int vertices - number of vertices
+// const vector<pair<int, int>>& edges - edge array (u, v)
+// const GraphBuildOptions& options - build options
+// GraphBuildStats* stats - optional output statistics (may be nullptr)
+// Output:
+// Returns a new ListGraph whose lists are allocated at their exact size
+ListGraph* buildListGraph(int vertices,
+                          const vector<pair<int, int>>& edges,
+                          const GraphBuildOptions& options,
+                          GraphBuildStats* stats) {
+    return buildListFromInput(max(vertices, 0), makeInput(edges, nullptr), options, stats);
+}
+
+// Function: buildListGraph
+// Parameters:
+// int vertices - number of vertices
+// const vector<pair<int, int>>& edges - edge array (u, v)
+// const vector<EdgeWeight>& weights - weights[i] is the weight of edges[i]
+// const GraphBuildOptions& options - build options
+// GraphBuildStats* stats - optional output statistics (may be nullptr)
+// Output:
+// Returns a new weighted ListGraph built from edges
+ListGraph* buildListGraph(int vertices,
+                          const vector<pair<int, int>>& edges,
+                          const vector<EdgeWeight>& weights,
+                          const GraphBuildOptions& options,
+                          GraphBuildStats* stats) {
+    return buildListFromInput(max(vertices, 0), makeInput(edges, &weights), options, stats);
+}
+
+// Function: buildListGraph
+// Parameters:
+// int vertices - number of vertices
+// const vector<vector<pair<int, int>>>& edgeBuffers - per-thread edge buffers
+// const GraphBuildOptions& options - build options
+// GraphBuildStats* stats - optional output statistics (may be nullptr)
+// Output:
+// Returns a new ListGraph built from all buffers
+ListGraph* buildListGraph(int vertices,
+                          const vector<vector<pair<int, int>>>& edgeBuffers,
+                          const GraphBuildOptions& options,
+                          GraphBuildStats* stats) {
+    return buildListFromInput(max(vertices, 0), makeInput(edgeBuffers), options, stats);
+}
@@ -185,7 +185,8 @@ static void runGraphvizExport(const IGraph& graph) {
 // Parameters:
 // const IGraph& graph - graph reference
 // Output:
-// Computes BFS shortest path and prints distance + reconstructed path
+// Computes a shortest start -> target path with bidirectional BFS and
+// prints distance + path
 static void runShortestPath(const IGraph& graph) {
     int start, target;
     cout << "Enter start vertex: ";
@@ -193,28 +194,28 @@ static void runShortestPath(const IGraph& graph) {
     cout << "Enter target vertex: ";
     cin >> target;
 
-    vector<int> dist, parent;
-    bfsShortestPaths(graph, start, dist, parent);
-
-    if (dist.empty()) {
+    int V = graph.getVertexCount();
+    if (start < 0 || start >= V) {
         cout << "Invalid start vertex." << endl;
         return;
     }
 
-    if (target < 0 || target >= (int)dist.size()) {
+    if (target < 0 || target >= V) {
         cout << "Invalid target vertex." << endl;
         return;
     }
 
-    if (dist[target] == -1) {
+    vector<int> path;
+    int distance = bidirectionalShortestPath(graph, start, target, path);
+
+    if (distance == -1) {
         cout << "No path exists from " << start << " to " << target << "." << endl;
         return;
     }
 
     cout << "Shortest distance from " << start << " to " << target
-         << " is " << dist[target] << " edges." << endl;
+         << " is " << distance << " edges." << endl;
 
-    vector<int> path = reconstructPath(start, target, parent);
     cout << "Path: ";
     for (int i = 0; i < (int)path.size(); i++) {
         cout << path[i];
@@ -1,37 +1,23 @@
 //***************************************************************
 // File: Graph_Connectivity.cpp
 // Description:
-//   Implements connectivity checking using BFS.
+//   Implements connectivity checking on top of the union-find
+//   connected components decomposition.
 //
 // Notes:
-//   - For undirected graphs, BFS uses getNeighbors directly.
-//   - For directed graphs, we check weak connectivity by allowing
-//     traversal along both outgoing and incoming edges.
+//   - For directed graphs, we check weak connectivity: edges are
+//     united as undirected pairs, reading out-edges only (no reverse
+//     adjacency is built)
+//   - See Connected_Components.h for the Afforest steps
+//   - A ListGraph with connectivity tracking on answers from its
+//     union-find in O(1)
 //***************************************************************
 
 #include "Graph_Connectivity.h"
-#include <vector>
-#include <queue>
+#include "Connected_Components.h"
+#include "List_Implementation_Graph.h"
 using namespace std;
 
-// Function: buildReverseAdj
-// Parameters:
-// const IGraph& graph - graph reference
-// vector<vector<int>>& rev - output reverse adjacency list
-// Output:
-// Fills rev[v] with all u such that u -> v exists
-static void buildReverseAdj(const IGraph& graph, vector<vector<int>>& rev) {
-    int V = graph.getVertexCount();
-    rev.assign(V, {});
-
-    for (int u = 0; u < V; u++) {
-        for (int v : graph.getNeighbors(u)) {
-            if (v < 0 || v >= V) continue;
-            rev[v].push_back(u);
-        }
-    }
-}
-
 // Function: isConnected
 // Parameters:
 // const IGraph& graph - graph reference
@@ -40,48 +26,8 @@ static void buildReverseAdj(const IGraph& graph, vector<vector<int>>& rev) {
 // Notes:
 // - Directed graphs are treated as weakly connected here
 bool isConnected(const IGraph& graph) {
-    int V = graph.getVertexCount();
-    if (V == 0) return true;
-
-    vector<bool> visited(V, false);
-    queue<int> q;
-
-    // Build reverse adjacency only if needed
-    vector<vector<int>> rev;
-    if (graph.isDirected()) {
-        buildReverseAdj(graph, rev);
-    }
-
-    q.push(0);
-    visited[0] = true;
-
-    while (!q.empty()) {
-        int u = q.front();
-        q.pop();
-
-        // Outgoing neighbors
-        for (int v : graph.getNeighbors(u)) {
-            if (v < 0 || v >= V) continue;
-            if (!visited[v]) {
-                visited[v] = true;
-                q.push(v);
-            }
-        }
-
-        // Incoming neighbors (for weak connectivity in directed graphs)
-        if (graph.isDirected()) {
-            for (int v : rev[u]) {
-                if (v < 0 || v >= V) continue;
-                if (!visited[v]) {
-                    visited[v] = true;
-                    q.push(v);
-                }
-            }
-        }
-    }
+    const ListGraph* list = dynamic_cast<const ListGraph*>(&graph);
+    if (list && list->isTrackingConnectivity()) return list->getComponentCount() <= 1;
 
-    for (bool seen : visited) {
-        if (!seen) return false;
-    }
-    return true;
+    return countConnectedComponents(graph) <= 1;
 }
@@ -0,0 +1,458 @@
+//***************************************************************
+// File: Graph_Reordering.cpp
+// Description:
+//   Implements vertex ordering strategies, the VertexPermutation
+//   helpers, and graph relabeling (see Graph_Reordering.h).
+//
+// Notes:
+//   - Orderings use the undirected view of the graph (out- and
+//     in-neighbors), and every strategy covers all components
+//   - Ties are always broken by the original ID, so every order is
+//     deterministic
+//***************************************************************
+
+#include "Graph_Reordering.h"
+#include "List_Implementation_Graph.h"
+#include "Matrix_Implementation_Graph.h"
+#include "CSR_Implementation_Graph.h"
+#include "Compressed_Implementation_Graph.h"
+
+#include <algorithm>
+#include <memory>
+using namespace std;
+
+namespace {
+
+// Function: forEachUndirectedNeighbor
+// Parameters:
+// const IGraph& graph - graph reference
+// int u - vertex to query
+// F&& visit - callable taking a neighbor
+// Output:
+// Reports out-neighbors, plus in-neighbors for directed graphs
+template <typename F>
+void forEachUndirectedNeighbor(const IGraph& graph, int u, F&& visit) {
+    graph.forEachNeighbor(u, visit);
+    if (graph.isDirected()) graph.forEachInNeighbor(u, visit);
+}
+
+// Function: undirectedDegrees
+// Parameters:
+// const IGraph& graph - graph reference
+// Output:
+// Returns out-degree (+ in-degree when directed) of every vertex
+vector<long long> undirectedDegrees(const IGraph& graph) {
+    int V = graph.getVertexCount();
+    vector<long long> degree(V, 0);
+    for (int u = 0; u < V; u++) {
+        degree[u] = graph.getOutDegree(u);
+        if (graph.isDirected()) degree[u] += graph.getInDegree(u);
+    }
+    return degree;
+}
+
+// Function: reverseCuthillMcKee
+// Parameters:
+// const IGraph& graph - graph reference
+// Output:
+// Returns the RCM order (order[newId] = oldId)
+// Notes:
+// - Each component starts at its lowest-degree unvisited vertex
+// - The BFS queue is the order array itself
+vector<int> reverseCuthillMcKee(const IGraph& graph) {
+    int V = graph.getVertexCount();
+    vector<long long> degree = undirectedDegrees(graph);
+
+    auto byDegree = [&](int a, int b) {
+        return degree[a] != degree[b] ? degree[a] < degree[b] : a < b;
+    };
+
+    vector<int> starts(V);
+    for (int u = 0; u < V; u++) starts[u] = u;
+    sort(starts.begin(), starts.end(), byDegree);
+
+    vector<bool> visited(V, false);
+    vector<int> order;
+    order.reserve(V);
+    vector<int> next;
+
+    for (int s : starts) {
+        if (visited[s]) continue;
+
+        visited[s] = true;
+        order.push_back(s);
+
+        for (size_t head = order.size() - 1; head < order.size(); head++) {
+            next.clear();
+            forEachUndirectedNeighbor(graph, order[head], [&](int v) {
+                if (v < 0 || v >= V || visited[v]) return;
+                visited[v] = true;
+                next.push_back(v);
+            });
+
+            sort(next.begin(), next.end(), byDegree);
+            order.insert(order.end(), next.begin(), next.end());
+        }
+    }
+
+    reverse(order.begin(), order.end());
+    return order;
+}
+
+// Function: degreeDescending
+// Parameters:
+// const IGraph& graph - graph reference
+// Output:
+// Returns vertices by decreasing degree (ties by ID)
+vector<int> degreeDescending(const IGraph& graph) {
+    int V = graph.getVertexCount();
+    vector<long long> degree = undirectedDegrees(graph);
+
+    vector<int> order(V);
+    for (int u = 0; u < V; u++) order[u] = u;
+    stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        return degree[a] > degree[b];
+    });
+    return order;
+}
+
+// Function: traversalOrder
+// Parameters:
+// const IGraph& graph - graph reference
+// int start - first root
+// bool depthFirst - DFS preorder if true, BFS order otherwise
+// Output:
+// Returns the traversal order from start, then from every still
+// unvisited vertex in ID order
+// Notes:
+// - The DFS uses an explicit stack; neighbors are pushed in reverse
+//   so the preorder matches the recursive definition
+vector<int> traversalOrder(const IGraph& graph, int start, bool depthFirst) {
+    int V = graph.getVertexCount();
+    vector<bool> visited(V, false);
+    vector<int> order;
+    order.reserve(V);
+
+    vector<int> stack;
+    vector<int> next;
+
+    auto runFrom = [&](int root) {
+        if (depthFirst) {
+            stack.push_back(root);
+            while (!stack.empty()) {
+                int u = stack.back();
+                stack.pop_back();
+                if (visited[u]) continue;
+
+                visited[u] = true;
+                order.push_back(u);
+
+                next.clear();
+                forEachUndirectedNeighbor(graph, u, [&](int v) {
+                    if (v >= 0 && v < V && !visited[v]) next.push_back(v);
+                });
+                stack.insert(stack.end(), next.rbegin(), next.rend());
+            }
+        } else {
+            visited[root] = true;
+            order.push_back(root);
+            for (size_t head = order.size() - 1; head < order.size(); head++) {
+                forEachUndirectedNeighbor(graph, order[head], [&](int v) {
+                    if (v < 0 || v >= V || visited[v]) return;
+                    visited[v] = true;
+                    order.push_back(v);
+                });
+            }
+        }
+    };
+
+    if (start >= 0 && start < V) runFrom(start);
+    for (int u = 0; u < V; u++) {
+        if (!visited[u]) runFrom(u);
+    }
+    return order;
+}
+
+// Function: hubClustering
+// Parameters:
+// const IGraph& graph - graph reference
+// Output:
+// Returns hubs (degree above average) first, then the other vertices,
+// each group in original ID order
+vector<int> hubClustering(const IGraph& graph) {
+    int V = graph.getVertexCount();
+    vector<long long> degree = undirectedDegrees(graph);
+
+    long long total = 0;
+    for (long long d : degree) total += d;
+
+    // Degrees are integers, so "above the average" = above its floor
+    long long average = V > 0 ? total / V : 0;
+
+    vector<int> order;
+    order.reserve(V);
+    for (int u = 0; u < V; u++) {
+        if (degree[u] > average) order.push_back(u);
+    }
+    for (int u = 0; u < V; u++) {
+        if (degree[u] <= average) order.push_back(u);
+    }
+    return order;
+}
+
+// Function: relabelRows
+// Parameters:
+// const IGraph& graph - graph to relabel
+// const VertexPermutation& p - mapping
+// vector<vector<EdgeWeight>>* weights - optional output, weights of the rows
+// Output:
+// Returns relabeled neighbor lists indexed by new ID
+vector<vector<int>> relabelRows(const IGraph& graph,
+                                const VertexPermutation& p,
+                                vector<vector<EdgeWeight>>* weights) {
+    int V = graph.getVertexCount();
+    vector<vector<int>> rows(V);
+    if (weights) weights->assign(V, {});
+
+    for (int u = 0; u < V; u++) {
+        vector<int>& row = rows[p.toNew(u)];
+        row.reserve(graph.getOutDegree(u));
+        if (weights) {
+            vector<EdgeWeight>& rowWeights = (*weights)[p.toNew(u)];
+            graph.forEachWeightedNeighbor(u, [&](int v, EdgeWeight w) {
+                row.push_back(p.toNew(v));
+                rowWeights.push_back(w);
+            });
+        } else {
+            graph.forEachNeighbor(u, [&](int v) { row.push_back(p.toNew(v)); });
+        }
+    }
+    return rows;
+}
+
+// Function: relabelCSR
+// Parameters:
+// const IGraph& graph - graph to relabel
+// const VertexPermutation& p - mapping
+// Output:
+// Returns a new CSRGraph holding the relabeled rows
+CSRGraph* relabelCSR(const IGraph& graph, const VertexPermutation& p) {
+    int V = graph.getVertexCount();
+
+    vector<long long> offsets(V + 1, 0);
+    for (int n = 0; n < V; n++) {
+        offsets[n + 1] = offsets[n] + graph.getOutDegree(p.toOld(n));
+    }
+
+    vector<int> targets(offsets[V]);
+    if (graph.isWeighted()) {
+        vector<EdgeWeight> weights(offsets[V]);
+        for (int n = 0; n < V; n++) {
+            long long k = offsets[n];
+            graph.forEachWeightedNeighbor(p.toOld(n), [&](int v, EdgeWeight w) {
+                targets[k] = p.toNew(v);
+                weights[k++] = w;
+            });
+        }
+        return new CSRGraph(V, graph.isDirected(), move(offsets), move(targets),
+                            move(weights), vector<int>());
+    }
+
+    for (int n = 0; n < V; n++) {
+        long long k = offsets[n];
+        graph.forEachNeighbor(p.toOld(n), [&](int v) { targets[k++] = p.toNew(v); });
+    }
+
+    return new CSRGraph(V, graph.isDirected(), move(offsets), move(targets), vector<int>());
+}
+
+} // namespace
+
+// Function: VertexPermutation (Constructor)
+// Parameters:
+// vector<int> order - order[newId] = oldId
+// Output:
+// Stores order and fills the inverse
+// Notes:
+// - order must be a permutation of 0..n-1
+VertexPermutation::VertexPermutation(vector<int> order)
+    : newToOld(move(order)), oldToNew(newToOld.size(), -1) {
+    for (int n = 0; n < (int)newToOld.size(); n++) {
+        int old = newToOld[n];
+        if (old >= 0 && old < (int)oldToNew.size()) oldToNew[old] = n;
+    }
+}
+
+// Function: identity
+// Parameters:
+// int n - number of vertices
+// Output:
+// Returns the identity permutation on n vertices
+VertexPermutation VertexPermutation::identity(int n) {
+    vector<int> order(max(n, 0));
+    for (int i = 0; i < (int)order.size(); i++) order[i] = i;
+    return VertexPermutation(move(order));
+}
+
+// Function: size
+// Parameters:
+// None
+// Output:
+// Returns the number of vertices
+int VertexPermutation::size() const {
+    return (int)newToOld.size();
+}
+
+// Function: isBijection
+// Parameters:
+// None
+// Output:
+// Returns true if every original ID has a new ID
+// Notes:
+// - Both arrays have the same length, so no unmapped original ID
+//   means no duplicate either
+bool VertexPermutation::isBijection() const {
+    for (int n : oldToNew) {
+        if (n == -1) return false;
+    }
+    return true;
+}
+
+// Function: toNew
+// Parameters:
+// int oldId - original ID
+// Output:
+// Returns the relabeled ID, or -1 if out of range
+int VertexPermutation::toNew(int oldId) const {
+    if (oldId < 0 || oldId >= (int)oldToNew.size()) return -1;
+    return oldToNew[oldId];
+}
+
+// Function: toOld
+// Parameters:
+// int newId - relabeled ID
+// Output:
+// Returns the original ID, or -1 if out of range
+int VertexPermutation::toOld(int newId) const {
+    if (newId < 0 || newId >= (int)newToOld.size()) return -1;
+    return newToOld[newId];
+}
+
+// Function: getNewToOld
+// Parameters:
+// None
+// Output:
+// Returns newToOld (index = new ID)
+const vector<int>& VertexPermutation::getNewToOld() const {
+    return newToOld;
+}
+
+// Function: getOldToNew
+// Parameters:
+// None
+// Output:
+// Returns oldToNew (index = original ID)
+const vector<int>& VertexPermutation::getOldToNew() const {
+    return oldToNew;
+}
+
+// Function: verticesToOld
+// Parameters:
+// const vector<int>& newIds - list of new IDs
+// Output:
+// Returns the list translated to original IDs
+vector<int> VertexPermutation::verticesToOld(const vector<int>& newIds) const {
+    vector<int> result(newIds.size());
+    for (size_t i = 0; i < newIds.size(); i++) result[i] = toOld(newIds[i]);
+    return result;
+}
+
+// Function: verticesToNew
+// Parameters:
+// const vector<int>& oldIds - list of original IDs
+// Output:
+// Returns the list translated to new IDs
+vector<int> VertexPermutation::verticesToNew(const vector<int>& oldIds) const {
+    vector<int> result(oldIds.size());
+    for (size_t i = 0; i < oldIds.size(); i++) result[i] = toNew(oldIds[i]);
+    return result;
+}
+
+// Function: parentsToOld
+// Parameters:
+// const vector<int>& parentByNew - parent array on the relabeled graph
+// Output:
+// Returns the parent array in original IDs (index and value)
+vector<int> VertexPermutation::parentsToOld(const vector<int>& parentByNew) const {
+    vector<int> byOld(parentByNew.size(), -1);
+    for (size_t n = 0; n < parentByNew.size() && n < newToOld.size(); n++) {
+        int parent = parentByNew[n];
+        byOld[newToOld[n]] = (parent == -1) ? -1 : toOld(parent);
+    }
+    return byOld;
+}
+
+// Function: computeVertexOrder
+// Parameters:
+// const IGraph& graph - graph to order
+// ReorderStrategy strategy - ordering to compute
+// int start - first vertex for BFSOrder / DFSOrder
+// Output:
+// Returns the permutation for the chosen strategy
+VertexPermutation computeVertexOrder(const IGraph& graph,
+                                     ReorderStrategy strategy,
+                                     int start) {
+    switch (strategy) {
+        case ReorderStrategy::ReverseCuthillMcKee:
+            return VertexPermutation(reverseCuthillMcKee(graph));
+        case ReorderStrategy::DegreeDescending:
+            return VertexPermutation(degreeDescending(graph));
+        case ReorderStrategy::BFSOrder:
+            return VertexPermutation(traversalOrder(graph, start, false));
+        case ReorderStrategy::DFSOrder:
+            return VertexPermutation(traversalOrder(graph, start, true));
+        case ReorderStrategy::HubClustering:
+            return VertexPermutation(hubClustering(graph));
+    }
+    return VertexPermutation::identity(graph.getVertexCount());
+}
+
+// Function: relabelGraph
+// Parameters:
+// const IGraph& graph - graph to relabel
+// const VertexPermutation& permutation - mapping
+// Output:
+// Returns a new graph of the same representation with relabeled IDs
+IGraph* relabelGraph(const IGraph& graph, const VertexPermutation& permutation) {
+    int V = graph.getVertexCount();
+    if (permutation.size() != V || !permutation.isBijection()) return nullptr;
+
+    bool directed = graph.isDirected();
+
+    if (const MatrixGraph* m = dynamic_cast<const MatrixGraph*>(&graph)) {
+        MatrixGraph* result = new MatrixGraph(V, directed, m->isUpperTriangleOnly());
+        for (int u = 0; u < V; u++) {
+            int nu = permutation.toNew(u);
+            m->forEachNeighbor(u, [&](int v) {
+                result->addEdge(nu, permutation.toNew(v));
+            });
+        }
+        return result;
+    }
+
+    if (dynamic_cast<const CSRGraph*>(&graph)) {
+        return relabelCSR(graph, permutation);
+    }
+
+    if (dynamic_cast<const CompressedGraph*>(&graph)) {
+        unique_ptr<CSRGraph> relabeled(relabelCSR(graph, permutation));
+        return new CompressedGraph(*relabeled);
+    }
+
+    if (graph.isWeighted()) {
+        vector<vector<EdgeWeight>> weights;
+        vector<vector<int>> rows = relabelRows(graph, permutation, &weights);
+        return new ListGraph(V, directed, move(rows), move(weights));
+    }
+    return new ListGraph(V, directed, relabelRows(graph, permutation, nullptr));
+}
@@ -0,0 +1,474 @@
+//***************************************************************
+// File: Graph_Text_Import.cpp
+// Description:
+//   Implements the parallel text importer declared in
+//   Graph_Text_Import.h.
+//
+// Pipeline:
+//   1) mmap the file (read-only) and parse the Matrix Market header
+//      sequentially, if there is one
+//   2) Cut the body into chunks that start at line boundaries
+//   3) Workers pull chunks, parse lines with a hand-written parser
+//      and append edges to their own buffer
+//   4) Merge per-chunk counters in file order, then hand every buffer
+//      to the bulk builder without concatenating them
+//
+// Notes:
+//   - Line numbers of rejected lines are chunk-local while parsing and
+//     fixed up afterwards from per-chunk line counts
+//***************************************************************
+
+#include "Graph_Text_Import.h"
+#include "Parallel_Utils.h"
+
+#include <iostream>
+#include <atomic>
+#include <climits>
+#include <cstring>
+#include <cctype>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+namespace {
+
+// Smallest chunk handed to a worker, and chunks per worker
+const long long MIN_CHUNK_BYTES = 1 << 20;
+const int CHUNKS_PER_THREAD = 4;
+
+// Longest line text kept in a rejected-line sample
+const size_t MAX_SAMPLE_TEXT = 80;
+
+// Enum: LineKind
+// Purpose:
+//   Result of parsing one line.
+enum LineKind {
+    LINE_EDGE,
+    LINE_SKIP,      // blank or comment
+    LINE_BAD
+};
+
+// Struct: ChunkResult
+// Purpose:
+//   Counters and samples collected by the worker that parsed a chunk.
+struct ChunkResult {
+    long long lines = 0;
+    long long skipped = 0;
+    long long edges = 0;
+    long long rejected = 0;
+    vector<RejectedLine> samples;   // lineNumber is chunk-local here
+};
+
+// Struct: TextMapping
+// Purpose:
+//   Owns the read-only mapping of the input file.
+struct TextMapping {
+    const char* data = nullptr;
+    size_t length = 0;
+
+    ~TextMapping() {
+        if (data) munmap(const_cast<char*>(data), length);
+    }
+};
+
+// Function: isBlank
+// Parameters:
+// char c - character to test
+// Output:
+// Returns true for separators inside a line
+inline bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+// Function: readId
+// Parameters:
+// const char*& p - cursor, advanced past the number
+// const char* end - end of the line
+// long long& value - parsed value
+// const char*& reason - set when parsing fails
+// Output:
+// Returns true if a non-negative integer below INT_MAX was read
+inline bool readId(const char*& p, const char* end, long long& value, const char*& reason) {
+    if (p == end) {
+        reason = "expected two vertex ids";
+        return false;
+    }
+    if (*p == '-') {
+        reason = "negative vertex id";
+        return false;
+    }
+    if (*p < '0' || *p > '9') {
+        reason = "vertex id is not a number";
+        return false;
+    }
+
+    long long x = 0;
+    while (p != end && *p >= '0' && *p <= '9') {
+        x = x * 10 + (*p - '0');
+        if (x >= INT_MAX) {
+            reason = "vertex id too large";
+            return false;
+        }
+        ++p;
+    }
+
+    if (p != end && !isBlank(*p)) {
+        reason = "vertex id is not a number";
+        return false;
+    }
+
+    value = x;
+    return true;
+}
+
+// Function: parseEdgeLine
+// Parameters:
+// const char* p - start of the line
+// const char* end - end of the line (newline excluded)
+// long long& u - first id
+// long long& v - second id
+// const char*& reason - set for LINE_BAD
+// Output:
+// Classifies the line and extracts its first two ids
+// Notes:
+// - Anything after the second id (weights, values, timestamps) is
+//   ignored as long as it is separated by a blank
+inline LineKind parseEdgeLine(const char* p, const char* end,
+                              long long& u, long long& v, const char*& reason) {
+    while (p != end && isBlank(*p)) ++p;
+    if (p == end || *p == '#' || *p == '%') return LINE_SKIP;
+
+    if (!readId(p, end, u, reason)) return LINE_BAD;
+    while (p != end && isBlank(*p)) ++p;
+    if (!readId(p, end, v, reason)) return LINE_BAD;
+
+    return LINE_EDGE;
+}
+
+// Function: lineEnd
+// Parameters:
+// const char* p - start of a line
+// const char* end - end of the buffer
+// Output:
+// Returns a pointer to the line's '\n', or end
+inline const char* lineEnd(const char* p, const char* end) {
+    const void* nl = memchr(p, '\n', end - p);
+    return nl ? static_cast<const char*>(nl) : end;
+}
+
+// Function: lowerCopy
+// Parameters:
+// const char* p - start of text
+// const char* end - end of text
+// Output:
+// Returns the text in lower case
+string lowerCopy(const char* p, const char* end) {
+    string s(p, end);
+    for (char& c : s) c = (char)tolower((unsigned char)c);
+    return s;
+}
+
+// Struct: MatrixMarketHeader
+// Purpose:
+//   Fields taken from the banner and size line.
+struct MatrixMarketHeader {
+    bool directed = true;
+    long long rows = 0;
+    long long cols = 0;
+    long long bodyStart = 0;    // byte offset of the first entry line
+    long long headerLines = 0;  // lines before bodyStart
+};
+
+// Function: parseMatrixMarketHeader
+// Parameters:
+// const char* data - file contents
+// long long size - file size
+// MatrixMarketHeader& header - output fields
+// string& error - message on failure
+// Output:
+// Returns true if banner and size line are valid
+bool parseMatrixMarketHeader(const char* data, long long size,
+                             MatrixMarketHeader& header, string& error) {
+    const char* end = data + size;
+    const char* p = data;
+
+    // Banner: %%MatrixMarket matrix coordinate <field> <symmetry>
+    const char* e = lineEnd(p, end);
+    string banner = lowerCopy(p, e);
+    if (banner.find("%%matrixmarket") != 0) {
+        error = "missing Matrix Market banner";
+        return false;
+    }
+    if (banner.find("coordinate") == string::npos) {
+        error = "only coordinate Matrix Market files are supported";
+        return false;
+    }
+    header.directed = banner.find("general") != string::npos;
+    header.headerLines = 1;
+    p = (e == end) ? end : e + 1;
+
+    // Comments, then the size line "rows cols entries"
+    while (p < end) {
+        e = lineEnd(p, end);
+        header.headerLines++;
+
+        const char* q = p;
+        while (q != e && isBlank(*q)) ++q;
+        if (q == e || *q == '%') {
+            p = (e == end) ? end : e + 1;
+            continue;
+        }
+
+        long long rows, cols;
+        const char* reason = nullptr;
+        if (parseEdgeLine(q, e, rows, cols, reason) != LINE_EDGE) {
+            error = "invalid Matrix Market size line";
+            return false;
+        }
+
+        header.rows = rows;
+        header.cols = cols;
+        header.bodyStart = (e == end) ? size : (e + 1 - data);
+        return true;
+    }
+
+    error = "missing Matrix Market size line";
+    return false;
+}
+
+// Function: chunkBoundaries
+// Parameters:
+// const char* data - file contents
+// long long begin - first body byte
+// long long end - file size
+// int threads - worker count
+// Output:
+// Returns increasing boundaries; every chunk starts at a line start
+vector<long long> chunkBoundaries(const char* data, long long begin, long long end, int threads) {
+    long long bytes = end - begin;
+    long long chunks = max(1LL, min((long long)threads * CHUNKS_PER_THREAD,
+                                    bytes / MIN_CHUNK_BYTES));
+
+    vector<long long> bounds;
+    bounds.push_back(begin);
+
+    for (long long i = 1; i < chunks; i++) {
+        long long b = begin + bytes * i / chunks;
+        if (b <= bounds.back()) continue;
+
+        const char* nl = lineEnd(data + b - 1, data + end);  // split after a '\n'
+        b = (nl == data + end) ? end : (nl + 1 - data);
+        if (b > bounds.back() && b < end) bounds.push_back(b);
+    }
+
+    bounds.push_back(end);
+    return bounds;
+}
+
+} // namespace
+
+// Function: importTextGraph
+// Parameters:
+// const string& filename - text file to read
+// const TextImportOptions& options - parsing and build options
+// ImportReport* report - optional output report (may be nullptr)
+// Output:
+// Returns a new CSRGraph (or ListGraph), or nullptr on failure
+IGraph* importTextGraph(const string& filename,
+                        const TextImportOptions& options,
+                        ImportReport* report) {
+    ImportReport local;
+    ImportReport& r = report ? *report : local;
+    r = ImportReport();
+
+    // 1) Map the file
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        r.error = "cannot open " + filename;
+        return nullptr;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        r.error = "cannot stat " + filename;
+        return nullptr;
+    }
+
+    TextMapping mapping;
+    long long size = (long long)info.st_size;
+    if (size > 0) {
+        void* address = mmap(nullptr, (size_t)size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED) {
+            close(fd);
+            r.error = "mmap failed for " + filename;
+            return nullptr;
+        }
+        mapping.data = static_cast<const char*>(address);
+        mapping.length = (size_t)size;
+        madvise(address, (size_t)size, MADV_SEQUENTIAL);
+    }
+    close(fd);
+
+    const char* data = mapping.data;
+    r.bytes = size;
+
+    // 2) Format and header
+    TextGraphFormat format = options.format;
+    if (format == TextGraphFormat::Auto) {
+        bool banner = size >= 14 && lowerCopy(data, data + 14) == "%%matrixmarket";
+        format = banner ? TextGraphFormat::MatrixMarket : TextGraphFormat::EdgeList;
+    }
+
+    bool matrixMarket = (format == TextGraphFormat::MatrixMarket);
+    bool directed = options.directed;
+    long long bodyStart = 0;
+    long long headerLines = 0;
+    long long knownVertices = options.vertices > 0 ? options.vertices : 0;
+
+    if (matrixMarket) {
+        MatrixMarketHeader header;
+        if (!parseMatrixMarketHeader(data, size, header, r.error)) return nullptr;
+
+        directed = header.directed;
+        bodyStart = header.bodyStart;
+        headerLines = header.headerLines;
+        knownVertices = max(header.rows, header.cols);
+        if (knownVertices >= INT_MAX) {
+            r.error = "matrix dimension too large";
+            return nullptr;
+        }
+    }
+
+    // 3) Parallel parse
+    int threads = resolveThreadCount(options.threads);
+    vector<long long> bounds = chunkBoundaries(data, bodyStart, size, threads);
+    int chunkCount = (int)bounds.size() - 1;
+
+    vector<ChunkResult> results(chunkCount);
+    vector<vector<pair<int, int>>> buffers(threads);
+    vector<long long> maxIds(threads, -1);
+    atomic<int> nextChunk(0);
+    int maxSamples = max(0, options.maxReportedLines);
+    long long indexShift = matrixMarket ? 1 : 0;
+
+    parallelForEachWorker(threads, [&](int worker, int) {
+        vector<pair<int, int>>& out = buffers[worker];
+        long long maxId = -1;
+
+        while (true) {
+            int c = nextChunk.fetch_add(1);
+            if (c >= chunkCount) break;
+
+            ChunkResult& res = results[c];
+            const char* p = data + bounds[c];
+            const char* end = data + bounds[c + 1];
+            out.reserve(out.size() + (size_t)((end - p) / 12));
+
+            while (p < end) {
+                const char* e = lineEnd(p, end);
+                res.lines++;
+
+                long long u = 0, v = 0;
+                const char* reason = nullptr;
+                LineKind kind = parseEdgeLine(p, e, u, v, reason);
+
+                if (kind == LINE_EDGE) {
+                    u -= indexShift;
+                    v -= indexShift;
+                    if (u < 0 || v < 0) {
+                        kind = LINE_BAD;
+                        reason = "index 0 in a 1-based file";
+                    } else if (knownVertices > 0 && (u >= knownVertices || v >= knownVertices)) {
+                        kind = LINE_BAD;
+                        reason = "vertex id out of range";
+                    }
+                }
+
+                if (kind == LINE_EDGE) {
+                    out.push_back({(int)u, (int)v});
+                    maxId = max(maxId, max(u, v));
+                    res.edges++;
+                } else if (kind == LINE_SKIP) {
+                    res.skipped++;
+                } else {
+                    res.rejected++;
+                    if ((int)res.samples.size() < maxSamples) {
+                        const char* textEnd = e;
+                        if (textEnd != p && textEnd[-1] == '\r') --textEnd;
+                        size_t length = min((size_t)(textEnd - p), MAX_SAMPLE_TEXT);
+                        res.samples.push_back({res.lines, string(p, length), reason});
+                    }
+                }
+
+                p = (e == end) ? end : e + 1;
+            }
+        }
+
+        maxIds[worker] = maxId;
+    });
+
+    // 4) Merge counters in file order
+    r.lines = headerLines;
+    r.commentLines = headerLines;
+    for (const ChunkResult& res : results) {
+        for (const RejectedLine& line : res.samples) {
+            if ((int)r.rejectedSamples.size() >= maxSamples) break;
+            r.rejectedSamples.push_back({r.lines + line.lineNumber, line.text, line.reason});
+        }
+        r.lines += res.lines;
+        r.commentLines += res.skipped;
+        r.edgesParsed += res.edges;
+        r.rejectedLines += res.rejected;
+    }
+
+    long long vertices = knownVertices;
+    if (vertices == 0) {
+        for (long long id : maxIds) vertices = max(vertices, id + 1);
+    }
+
+    // 5) Build
+    GraphBuildOptions build;
+    build.directed = directed;
+    build.dropSelfLoops = options.dropSelfLoops;
+    build.deduplicate = options.deduplicate;
+    build.threads = options.threads;
+
+    if (options.buildList) return buildListGraph((int)vertices, buffers, build, &r.build);
+    return buildCSRGraph((int)vertices, buffers, build, &r.build);
+}
+
+// Function: printImportReport
+// Parameters:
+// const ImportReport& report - report to print
+// Output:
+// Prints counts and the sampled rejected lines
+void printImportReport(const ImportReport& report) {
+    if (!report.error.empty()) {
+        cout << "Import failed: " << report.error << endl;
+        return;
+    }
+
+    cout << "Import summary:" << endl;
+    cout << "  Lines read: " << report.lines << endl;
+    cout << "  Edges parsed: " << report.edgesParsed << endl;
+    cout << "  Comment/blank lines: " << report.commentLines << endl;
+    cout << "  Rejected lines: " << report.rejectedLines << endl;
+
+    for (const RejectedLine& line : report.rejectedSamples) {
+        cout << "    line " << line.lineNumber << ": \"" << line.text << "\" ("
+             << line.reason << ")" << endl;
+    }
+
+    if (report.build.selfLoopsDropped > 0) {
+        cout << "  Self-loops dropped: " << report.build.selfLoopsDropped << endl;
+    }
+    if (report.build.duplicatesRemoved > 0) {
+        cout << "  Duplicate entries removed: " << report.build.duplicatesRemoved << endl;
+    }
+    cout << "  Stored adjacency entries: " << report.build.storedEntries << endl;
+}
@@ -0,0 +1,212 @@
+//***************************************************************
+// File: Graph_Traversal.cpp
+// Description:
+//   Implements the visitor-driven BFS and DFS engines declared in
+//   Graph_Traversal.h.
+//
+// Notes:
+//   - The engines are templates over the concrete graph type
+//     (Graph_Dispatch.h) and over the visitor, so the overloads
+//     without a visitor compile to plain loops with no callbacks
+//   - DFS runs on the iterative DFSEngine (DFS_Engine.h); an adapter
+//     fills the result and forwards the events to the visitor
+//***************************************************************
+
+#include "Graph_Traversal.h"
+#include "Graph_Dispatch.h"
+#include "DFS_Engine.h"
+#include <queue>
+using namespace std;
+
+namespace {
+
+// Struct: NoVisitor
+// Purpose:
+//   Inline do-nothing visitor for the overloads without callbacks.
+struct NoVisitor {
+    bool discoverVertex(int, int) { return true; }
+    bool examineEdge(int, int) { return true; }
+    bool finishVertex(int) { return true; }
+};
+
+// Struct: DFSTraversalAdapter
+// Purpose:
+//   DFSEngine visitor that records order/parent/depth and forwards
+//   the events to a TraversalVisitor (or NoVisitor).
+template <typename Vis>
+struct DFSTraversalAdapter : DFSVisitorBase {
+    Vis& visitor;
+    TraversalResult& result;
+
+    DFSTraversalAdapter(Vis& v, TraversalResult& r) : visitor(v), result(r) {}
+
+    bool discoverVertex(int u, int from) {
+        if (from != -1) {
+            result.parent[u] = from;
+            result.depth[u] = result.depth[from] + 1;
+            result.order.push_back(u);
+        }
+        return visitor.discoverVertex(u, result.depth[u]);
+    }
+
+    bool examineEdge(int u, int v) {
+        return visitor.examineEdge(u, v);
+    }
+
+    bool finishVertex(int u, int) {
+        return visitor.finishVertex(u);
+    }
+};
+
+// Function: startResult
+// Parameters:
+// int V - vertex count
+// int start - starting vertex
+// TraversalResult& result - result to initialize
+// Output:
+// Sizes the arrays and records start as discovered at depth 0
+void startResult(int V, int start, TraversalResult& result) {
+    result.order.clear();
+    result.parent.assign(V, -1);
+    result.depth.assign(V, -1);
+    result.stopped = false;
+
+    result.order.push_back(start);
+    result.depth[start] = 0;
+}
+
+// Function: runBFS
+// Parameters:
+// const G& graph - concrete graph type
+// int start - starting vertex
+// Vis& visitor - TraversalVisitor or NoVisitor
+// Output:
+// Returns the BFS result, stopping when a callback returns false
+template <typename G, typename Vis>
+TraversalResult runBFS(const G& graph, int start, Vis& visitor) {
+    int V = graph.getVertexCount();
+    TraversalResult result;
+    if (start < 0 || start >= V) return result;
+
+    startResult(V, start, result);
+    vector<int>& parent = result.parent;
+    vector<int>& depth = result.depth;
+
+    if (!visitor.discoverVertex(start, 0)) {
+        result.stopped = true;
+        return result;
+    }
+
+    queue<int> q;
+    q.push(start);
+
+    while (!q.empty()) {
+        int u = q.front();
+        q.pop();
+
+        bool stop = false;
+        graph.forEachNeighbor(u, [&](int v) {
+            if (v < 0 || v >= V) return true; // safety guard
+
+            if (!visitor.examineEdge(u, v)) {
+                stop = true;
+                return false;
+            }
+
+            if (depth[v] == -1) {
+                depth[v] = depth[u] + 1;
+                parent[v] = u;
+                result.order.push_back(v);
+                q.push(v);
+
+                if (!visitor.discoverVertex(v, depth[v])) {
+                    stop = true;
+                    return false;
+                }
+            }
+            return true;
+        });
+
+        if (stop || !visitor.finishVertex(u)) {
+            result.stopped = true;
+            return result;
+        }
+    }
+
+    return result;
+}
+
+// Function: runDFS
+// Parameters:
+// const G& graph - concrete graph type
+// int start - starting vertex
+// Vis& visitor - TraversalVisitor or NoVisitor
+// Output:
+// Returns the DFS result, stopping when a callback returns false
+template <typename G, typename Vis>
+TraversalResult runDFS(const G& graph, int start, Vis& visitor) {
+    int V = graph.getVertexCount();
+    TraversalResult result;
+    if (start < 0 || start >= V) return result;
+
+    startResult(V, start, result);
+
+    DFSEngine<G> dfs(graph);
+    DFSTraversalAdapter<Vis> adapter(visitor, result);
+    result.stopped = !dfs.run(start, adapter);
+    return result;
+}
+
+} // namespace
+
+// Function: breadthFirstTraversal
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - starting vertex
+// TraversalVisitor& visitor - event callbacks
+// Output:
+// Returns order/parent/depth of the BFS from start
+TraversalResult breadthFirstTraversal(const IGraph& graph, int start, TraversalVisitor& visitor) {
+    return dispatchGraph(graph, [&](const auto& g) {
+        return runBFS(g, start, visitor);
+    });
+}
+
+// Function: breadthFirstTraversal
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - starting vertex
+// Output:
+// Returns order/parent/depth of the BFS from start (no callbacks)
+TraversalResult breadthFirstTraversal(const IGraph& graph, int start) {
+    NoVisitor visitor;
+    return dispatchGraph(graph, [&](const auto& g) {
+        return runBFS(g, start, visitor);
+    });
+}
+
+// Function: depthFirstTraversal
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - starting vertex
+// TraversalVisitor& visitor - event callbacks
+// Output:
+// Returns order/parent/depth of the DFS from start
+TraversalResult depthFirstTraversal(const IGraph& graph, int start, TraversalVisitor& visitor) {
+    return dispatchGraph(graph, [&](const auto& g) {
+        return runDFS(g, start, visitor);
+    });
+}
+
+// Function: depthFirstTraversal
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - starting vertex
+// Output:
+// Returns order/parent/depth of the DFS from start (no callbacks)
+TraversalResult depthFirstTraversal(const IGraph& graph, int start) {
+    NoVisitor visitor;
+    return dispatchGraph(graph, [&](const auto& g) {
+        return runDFS(g, start, visitor);
+    });
+}
@@ -4,13 +4,20 @@
 //   Implements a function to check whether a graph is a tree.
 //
 // Notes:
-//   - Uses isConnected + hasCycle checks
+//   - A connected graph on V vertices is a tree exactly when it has
+//     V - 1 edges, so the edge count (no self-loops allowed) is
+//     checked first and the union-find connectivity check second
+//   - Parallel edges count separately, so a multigraph with a doubled
+//     edge is not a tree (same as the cycle-based definition)
+//   - A ListGraph with connectivity tracking on answers from its
+//     component count and cycle flag in O(1)
 //   - Directed graphs are automatically not trees in this project
 //***************************************************************
 
 #include "Graph_Tree.h"
-#include "Graph_Connectivity.h"
-#include "Cycle_Detection.h"
+#include "Graph_Dispatch.h"
+#include "Connected_Components.h"
+#include "List_Implementation_Graph.h"
 
 // Function: isTree
 // Parameters:
@@ -19,7 +26,28 @@
 // Returns true if graph is undirected, connected, and acyclic
 bool isTree(const IGraph& graph) {
     if (graph.isDirected()) return false;
-    if (!isConnected(graph)) return false;
-    if (hasCycle(graph)) return false;
-    return true;
+
+    int V = graph.getVertexCount();
+    if (V == 0) return true;
+
+    const ListGraph* list = dynamic_cast<const ListGraph*>(&graph);
+    if (list && list->isTrackingConnectivity()) {
+        return list->getComponentCount() == 1 && !list->hasTrackedCycle();
+    }
+
+    // Every undirected edge is stored at both ends; count it from the
+    // smaller one and stop as soon as there are too many
+    bool fits = dispatchGraph(graph, [V](const auto& g) {
+        long long edges = 0;
+        bool ok = true;
+        for (int u = 0; u < V && ok; u++) {
+            g.forEachNeighbor(u, [&](int v) {
+                if (v == u || (v > u && ++edges > V - 1)) ok = false;
+                return ok;
+            });
+        }
+        return ok && edges == V - 1;
+    });
+
+    return fits && countConnectedComponents(graph) == 1;
 }
@@ -42,16 +42,14 @@ bool exportToDotFile(const IGraph& graph, const string& filename) {
 
     // Print edges
     for (int u = 0; u < V; u++) {
-        vector<int> neighbors = graph.getNeighbors(u);
-
-        for (int v : neighbors) {
-            if (v < 0 || v >= V) continue;
+        graph.forEachNeighbor(u, [&](int v) {
+            if (v < 0 || v >= V) return;
 
             // For undirected graphs, avoid duplicates: print only u <= v
-            if (!directed && u > v) continue;
+            if (!directed && u > v) return;
 
             out << "  " << u << " " << arrow << " " << v << ";\n";
-        }
+        });
     }
 
     out << "}\n";
@@ -32,14 +32,14 @@ static vector<int> neighborsOfSubsetRestricted(const IGraph& graph,
     for (int u : subset) {
         if (u < 0 || u >= V) continue;
 
-        for (int v : graph.getNeighbors(u)) {
-            if (v < 0 || v >= V) continue;
-            if (!allowed[v]) continue;
+        graph.forEachNeighbor(u, [&](int v) {
+            if (v < 0 || v >= V) return;
+            if (!allowed[v]) return;
 
             if (find(neighbors.begin(), neighbors.end(), v) == neighbors.end()) {
                 neighbors.push_back(v);
             }
-        }
+        });
     }
 
     return neighbors;
@@ -0,0 +1,639 @@
+//***************************************************************
+// File: Landmark_Distance_Oracle.cpp
+// Description:
+//   Implements the landmark distance oracle declared in
+//   Landmark_Distance_Oracle.h.
+//
+// Notes:
+//   - Landmark BFS runs are templates over the concrete graph type
+//     (Graph_Dispatch.h); independent runs are spread over worker
+//     threads through an atomic counter
+//   - The exact query is the level-synchronous bidirectional BFS of
+//     Shortest_Path_Unweighted.cpp with one addition: a vertex whose
+//     distance plus landmark lower bound cannot beat the best known
+//     path is recorded but never expanded
+//***************************************************************
+
+#include "Landmark_Distance_Oracle.h"
+#include "Graph_Dispatch.h"
+#include "Parallel_Utils.h"
+#include "Binary_File_Utils.h"
+
+#include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+using namespace std;
+
+namespace {
+
+const char LANDMARK_MAGIC[8] = {'G', 'R', 'A', 'P', 'H', 'L', 'M', 'K'};
+const uint32_t LANDMARK_FILE_VERSION = 1;
+const uint32_t LANDMARK_FLAG_DIRECTED = 1u << 0;
+
+// Struct: LandmarkFileHeader
+// Purpose:
+//   Fixed 64-byte header at the start of an oracle file.
+struct LandmarkFileHeader {
+    char magic[8];              // "GRAPHLMK"
+    uint32_t version;
+    uint32_t flags;
+    int64_t vertexCount;
+    int64_t landmarkCount;
+    int64_t entryCount;         // adjacency entries of the indexed graph
+    uint64_t bodyBytes;         // bytes following the header
+    uint64_t checksum;          // FNV-1a of the body
+    uint32_t byteOrder;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(LandmarkFileHeader) == 64, "LandmarkFileHeader must be 64 bytes");
+
+// Function: landmarkBFS
+// Parameters:
+// const G& graph - concrete graph type
+// int root - landmark vertex
+// bool backward - follow incoming edges (distances to root)
+// vector<int>& distance - output, -1 for unreached vertices
+// vector<int>& queue - scratch buffer
+// Output:
+// Fills distance with BFS distances from (or to) root
+template <typename G>
+void landmarkBFS(const G& graph,
+                 int root,
+                 bool backward,
+                 vector<int>& distance,
+                 vector<int>& queue) {
+    int V = graph.getVertexCount();
+    distance.assign(V, -1);
+    queue.clear();
+
+    distance[root] = 0;
+    queue.push_back(root);
+
+    for (size_t head = 0; head < queue.size(); head++) {
+        int u = queue[head];
+        auto visit = [&](int v) {
+            if (v < 0 || v >= V || distance[v] != -1) return;
+            distance[v] = distance[u] + 1;
+            queue.push_back(v);
+        };
+
+        if (backward) {
+            graph.forEachInNeighbor(u, visit);
+        } else {
+            graph.forEachNeighbor(u, visit);
+        }
+    }
+}
+
+// Function: storeColumn
+// Parameters:
+// vector<int>& table - vertex-major distance table
+// int k - number of landmarks
+// int column - landmark index
+// const vector<int>& distance - BFS distances of that landmark
+// Output:
+// Copies distance into column of table
+void storeColumn(vector<int>& table, int k, int column, const vector<int>& distance) {
+    for (size_t v = 0; v < distance.size(); v++) {
+        table[v * k + column] = distance[v];
+    }
+}
+
+// Function: runLandmarkBFS
+// Parameters:
+// const G& graph - concrete graph type
+// const vector<int>& landmarks - landmark vertices
+// int first - first landmark index to process
+// bool backward - follow incoming edges
+// vector<int>& table - vertex-major distance table to fill
+// int threads - worker count (0 = automatic)
+// Output:
+// Runs one BFS per landmark in [first, k) in parallel
+template <typename G>
+void runLandmarkBFS(const G& graph,
+                    const vector<int>& landmarks,
+                    int first,
+                    bool backward,
+                    vector<int>& table,
+                    int threads) {
+    int k = (int)landmarks.size();
+    if (first >= k) return;
+
+    int workers = min(resolveThreadCount(threads), k - first);
+    atomic<int> nextLandmark(first);
+
+    parallelForEachWorker(workers, [&](int, int) {
+        vector<int> distance, queue;
+        for (int i = nextLandmark++; i < k; i = nextLandmark++) {
+            landmarkBFS(graph, landmarks[i], backward, distance, queue);
+            storeColumn(table, k, i, distance);
+        }
+    });
+}
+
+// Function: combinedDegree
+// Parameters:
+// const IGraph& graph - graph being indexed
+// int v - vertex
+// Output:
+// Returns out-degree, plus in-degree on directed graphs
+long long combinedDegree(const IGraph& graph, int v) {
+    long long degree = graph.getOutDegree(v);
+    if (graph.isDirected()) degree += graph.getInDegree(v);
+    return degree;
+}
+
+// Function: highestDegreeVertices
+// Parameters:
+// const IGraph& graph - graph being indexed
+// int k - number of vertices wanted (<= V)
+// Output:
+// Returns the k vertices of largest combined degree (ties: lower ID)
+vector<int> highestDegreeVertices(const IGraph& graph, int k) {
+    int V = graph.getVertexCount();
+    vector<long long> degree(V);
+    vector<int> order(V);
+    for (int v = 0; v < V; v++) {
+        degree[v] = combinedDegree(graph, v);
+        order[v] = v;
+    }
+
+    partial_sort(order.begin(), order.begin() + k, order.end(), [&](int a, int b) {
+        if (degree[a] != degree[b]) return degree[a] > degree[b];
+        return a < b;
+    });
+    order.resize(k);
+    return order;
+}
+
+// Function: selectFarthestFirst
+// Parameters:
+// const G& graph - concrete graph type
+// int k - number of landmarks (<= V)
+// int first - initial landmark
+// vector<int>& landmarks - output landmark list
+// vector<int>& table - vertex-major d(L, v) table, filled on the way
+// Output:
+// Greedily adds the vertex whose distance from the nearest chosen
+// landmark is largest (unreached = infinite, ties: lower ID)
+// Notes:
+// - Sequential: every choice depends on the previous BFS
+template <typename G>
+void selectFarthestFirst(const G& graph,
+                         int k,
+                         int first,
+                         vector<int>& landmarks,
+                         vector<int>& table) {
+    int V = graph.getVertexCount();
+    vector<int> nearest(V, INT_MAX);
+    vector<int> distance, queue;
+
+    landmarks.clear();
+    int next = first;
+
+    while ((int)landmarks.size() < k) {
+        int column = (int)landmarks.size();
+        landmarks.push_back(next);
+
+        landmarkBFS(graph, next, false, distance, queue);
+        storeColumn(table, k, column, distance);
+
+        next = -1;
+        int farthest = -1;
+        for (int v = 0; v < V; v++) {
+            if (distance[v] != -1 && distance[v] < nearest[v]) nearest[v] = distance[v];
+            if (nearest[v] > farthest) {
+                farthest = nearest[v];
+                next = v;
+            }
+        }
+    }
+}
+
+} // namespace
+
+// Function: LandmarkDistanceOracle (Constructor)
+// Parameters:
+// None
+// Output:
+// Creates an empty oracle
+LandmarkDistanceOracle::LandmarkDistanceOracle()
+    : V(0), directed(false), graphEntries(0) {}
+
+// Function: build
+// Parameters:
+// const IGraph& graph - graph to index
+// const LandmarkOracleOptions& options - landmark count and strategy
+// Output:
+// Chooses landmarks and fills the distance tables
+void LandmarkDistanceOracle::build(const IGraph& graph, const LandmarkOracleOptions& options) {
+    V = graph.getVertexCount();
+    directed = graph.isDirected();
+    graphEntries = 0;
+    for (int v = 0; v < V; v++) graphEntries += graph.getOutDegree(v);
+
+    int k = max(0, min(options.landmarks, V));
+    landmarks.clear();
+    fromLandmark.assign((size_t)V * k, -1);
+    toLandmark.clear();
+    if (k == 0) return;
+
+    dispatchGraph(graph, [&](const auto& g) {
+        if (options.selection == LandmarkSelection::FarthestFirst) {
+            int first = highestDegreeVertices(graph, 1)[0];
+            selectFarthestFirst(g, k, first, landmarks, fromLandmark);
+        } else {
+            landmarks = highestDegreeVertices(graph, k);
+            runLandmarkBFS(g, landmarks, 0, false, fromLandmark, options.threads);
+        }
+
+        if (directed) {
+            toLandmark.assign((size_t)V * k, -1);
+            runLandmarkBFS(g, landmarks, 0, true, toLandmark, options.threads);
+        }
+    });
+}
+
+// Function: lowerBoundOrUnreachable
+// Parameters:
+// int s - source vertex (valid, != t)
+// int t - target vertex (valid)
+// Output:
+// Returns max(1, best triangle lower bound), or -1 if a landmark
+// separates s from t
+// Notes:
+// - Without landmarks (options.landmarks = 0) only the trivial bound
+//   is known: 1, or 0 when s == t
+int LandmarkDistanceOracle::lowerBoundOrUnreachable(int s, int t) const {
+    if (landmarks.empty()) return s == t ? 0 : 1;
+
+    int k = (int)landmarks.size();
+    const vector<int>& to = directed ? toLandmark : fromLandmark;
+    const int* fromS = &fromLandmark[(size_t)s * k];
+    const int* fromT = &fromLandmark[(size_t)t * k];
+    const int* toS = &to[(size_t)s * k];
+    const int* toT = &to[(size_t)t * k];
+
+    int lower = 1;
+    for (int i = 0; i < k; i++) {
+        // d(L, t) <= d(L, s) + d(s, t)
+        if (fromS[i] >= 0) {
+            if (fromT[i] < 0) return -1;    // L reaches s but not t
+            lower = max(lower, fromT[i] - fromS[i]);
+        }
+        // d(s, L) <= d(s, t) + d(t, L)
+        if (toT[i] >= 0) {
+            if (toS[i] < 0) return -1;      // t reaches L but s does not
+            lower = max(lower, toS[i] - toT[i]);
+        }
+    }
+    return lower;
+}
+
+// Function: upperBoundOrNone
+// Parameters:
+// int s - source vertex (valid)
+// int t - target vertex (valid)
+// Output:
+// Returns min over landmarks of d(s, L) + d(L, t), or -1
+// Notes:
+// - -1 without landmarks; the row pointers below would index an
+//   empty table
+int LandmarkDistanceOracle::upperBoundOrNone(int s, int t) const {
+    if (landmarks.empty()) return -1;
+
+    int k = (int)landmarks.size();
+    const vector<int>& to = directed ? toLandmark : fromLandmark;
+    const int* toS = &to[(size_t)s * k];
+    const int* fromT = &fromLandmark[(size_t)t * k];
+
+    int upper = -1;
+    for (int i = 0; i < k; i++) {
+        if (toS[i] < 0 || fromT[i] < 0) continue;
+        int through = toS[i] + fromT[i];
+        if (upper == -1 || through < upper) upper = through;
+    }
+    return upper;
+}
+
+// Function: bounds
+// Parameters:
+// int s - source vertex
+// int t - target vertex
+// Output:
+// Returns triangle-inequality bounds on d(s, t)
+DistanceBounds LandmarkDistanceOracle::bounds(int s, int t) const {
+    DistanceBounds result;
+    if (s < 0 || t < 0 || s >= V || t >= V) {
+        result.lower = -1;
+        result.unreachable = true;
+        return result;
+    }
+    if (s == t) {
+        result.upper = 0;
+        return result;
+    }
+
+    int lower = lowerBoundOrUnreachable(s, t);
+    if (lower == -1) {
+        result.lower = -1;
+        result.unreachable = true;
+        return result;
+    }
+
+    result.lower = lower;
+    result.upper = upperBoundOrNone(s, t);
+    return result;
+}
+
+// Function: exactDistance
+// Parameters:
+// const IGraph& graph - the graph the oracle was built on
+// int s - source vertex
+// int t - target vertex
+// BidirectionalBFSWorkspace& workspace - scratch arrays reused across calls
+// vector<int>* path - optional output shortest path (may be nullptr)
+// OracleQueryStats* stats - optional work counters (may be nullptr)
+// Output:
+// Returns d(s, t), or -1 if t is unreachable from s
+// Notes:
+// - best is the length a new path must beat. Without a path request
+//   it starts at the landmark upper bound, so the search only has to
+//   prove nothing shorter exists; with one it starts one above, so
+//   a path of that length is actually found
+// - Vertices on a path shorter than best always pass the pruning
+//   test (their lower bound is exact or smaller), so with both sides
+//   expanded to depths df and db every such path of length
+//   <= df + db has been seen; the search stops once df + db + 1 >= best
+int LandmarkDistanceOracle::exactDistance(const IGraph& graph,
+                                          int s,
+                                          int t,
+                                          BidirectionalBFSWorkspace& workspace,
+                                          vector<int>* path,
+                                          OracleQueryStats* stats) const {
+    OracleQueryStats local;
+    if (path) path->clear();
+    if (stats) *stats = local;
+
+    if (graph.getVertexCount() != V) return -1;
+
+    DistanceBounds known = bounds(s, t);
+    if (known.unreachable) return -1;
+    if (s == t) {
+        if (path) path->push_back(s);
+        return 0;
+    }
+    if (!path && known.upper == known.lower) {
+        local.answeredByBounds = true;
+        if (stats) *stats = local;
+        return known.upper;
+    }
+
+    BidirectionalBFSWorkspace& ws = workspace;
+    unsigned int current = ws.startQuery(V);
+
+    int best = INT_MAX;
+    if (known.upper != -1) best = path ? known.upper + 1 : known.upper;
+
+    int meet = dispatchGraph(graph, [&](const auto& g) {
+        ws.forwardStamp[s] = current;
+        ws.forwardDistance[s] = 0;
+        ws.forwardParent[s] = -1;
+        ws.backwardStamp[t] = current;
+        ws.backwardDistance[t] = 0;
+        ws.backwardParent[t] = -1;
+        local.verticesVisited = 2;
+
+        ws.forwardFrontier.assign(1, s);
+        ws.backwardFrontier.assign(1, t);
+
+        int found = -1;
+        int forwardDepth = 0;
+        int backwardDepth = 0;
+
+        // One level of one side; lowerBound(v) bounds the rest of the path
+        auto expand = [&](bool backward,
+                          vector<int>& frontier,
+                          vector<unsigned int>& stamp,
+                          vector<int>& distance,
+                          vector<int>& parent,
+                          const vector<unsigned int>& otherStamp,
+                          const vector<int>& otherDistance) {
+            ws.next.clear();
+
+            for (int u : frontier) {
+                auto visit = [&](int v) {
+                    if (v < 0 || v >= V || stamp[v] == current) return;
+
+                    stamp[v] = current;
+                    distance[v] = distance[u] + 1;
+                    parent[v] = u;
+                    local.verticesVisited++;
+
+                    if (otherStamp[v] == current && distance[v] + otherDistance[v] < best) {
+                        best = distance[v] + otherDistance[v];
+                        found = v;
+                    }
+
+                    int rest = backward ? lowerBoundOrUnreachable(s, v)
+                                        : lowerBoundOrUnreachable(v, t);
+                    if (v == (backward ? s : t)) rest = 0;
+
+                    if (rest == -1 || (long long)distance[v] + rest >= best) {
+                        local.verticesPruned++;
+                        return;
+                    }
+                    ws.next.push_back(v);
+                };
+
+                if (backward) {
+                    g.forEachInNeighbor(u, visit);
+                } else {
+                    g.forEachNeighbor(u, visit);
+                }
+            }
+
+            frontier.swap(ws.next);
+        };
+
+        while (!ws.forwardFrontier.empty() && !ws.backwardFrontier.empty()) {
+            if ((long long)forwardDepth + backwardDepth + 1 >= best) break;
+
+            if (ws.forwardFrontier.size() <= ws.backwardFrontier.size()) {
+                expand(false, ws.forwardFrontier,
+                       ws.forwardStamp, ws.forwardDistance, ws.forwardParent,
+                       ws.backwardStamp, ws.backwardDistance);
+                forwardDepth++;
+            } else {
+                expand(true, ws.backwardFrontier,
+                       ws.backwardStamp, ws.backwardDistance, ws.backwardParent,
+                       ws.forwardStamp, ws.forwardDistance);
+                backwardDepth++;
+            }
+        }
+
+        return found;
+    });
+    if (stats) *stats = local;
+
+    // No shorter path than the landmark bound: the bound is exact
+    if (meet == -1) return path ? -1 : known.upper;
+
+    if (path) {
+        for (int v = meet; v != -1; v = ws.forwardParent[v]) path->push_back(v);
+        reverse(path->begin(), path->end());
+        for (int v = ws.backwardParent[meet]; v != -1; v = ws.backwardParent[v]) {
+            path->push_back(v);
+        }
+    }
+    return best;
+}
+
+// Function: save
+// Parameters:
+// const string& filename - output file
+// Output:
+// Returns true if the whole index was written
+bool LandmarkDistanceOracle::save(const string& filename) const {
+    ofstream out(filename, ios::binary | ios::trunc);
+    if (!out.is_open()) return false;
+
+    LandmarkFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, LANDMARK_MAGIC, sizeof(header.magic));
+    header.version = LANDMARK_FILE_VERSION;
+    header.flags = directed ? LANDMARK_FLAG_DIRECTED : 0;
+    header.vertexCount = V;
+    header.landmarkCount = (int64_t)landmarks.size();
+    header.entryCount = graphEntries;
+    header.bodyBytes = sizeof(int32_t) * (landmarks.size() + fromLandmark.size() + toLandmark.size());
+    header.byteOrder = BYTE_ORDER_MARK;
+
+    uint64_t hash = FNV_OFFSET_BASIS;
+    hash = updateChecksum(hash, landmarks.data(), sizeof(int32_t) * landmarks.size());
+    hash = updateChecksum(hash, fromLandmark.data(), sizeof(int32_t) * fromLandmark.size());
+    hash = updateChecksum(hash, toLandmark.data(), sizeof(int32_t) * toLandmark.size());
+    header.checksum = hash;
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(landmarks.data()), sizeof(int32_t) * landmarks.size());
+    out.write(reinterpret_cast<const char*>(fromLandmark.data()), sizeof(int32_t) * fromLandmark.size());
+    out.write(reinterpret_cast<const char*>(toLandmark.data()), sizeof(int32_t) * toLandmark.size());
+    out.flush();
+    return (bool)out;
+}
+
+// Function: load
+// Parameters:
+// const string& filename - file written by save
+// string* error - optional message on failure (may be nullptr)
+// Output:
+// Replaces the index with the file contents, or returns false
+bool LandmarkDistanceOracle::load(const string& filename, string* error) {
+    ifstream in(filename, ios::binary);
+    if (!in.is_open()) return fail(error, "cannot open " + filename);
+
+    in.seekg(0, ios::end);
+    uint64_t fileSize = (uint64_t)in.tellg();
+    in.seekg(0, ios::beg);
+    if (fileSize < sizeof(LandmarkFileHeader)) return fail(error, "file too small for an oracle header");
+
+    LandmarkFileHeader header;
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    // 1) Header checks
+    if (memcmp(header.magic, LANDMARK_MAGIC, sizeof(header.magic)) != 0) {
+        return fail(error, "not a landmark oracle file (bad magic)");
+    }
+    if (header.byteOrder != BYTE_ORDER_MARK) {
+        return fail(error, "file was written with a different byte order");
+    }
+    if (header.version != LANDMARK_FILE_VERSION) {
+        return fail(error, "unsupported format version " + to_string(header.version));
+    }
+    if (header.vertexCount < 0 || header.vertexCount > INT_MAX ||
+        header.landmarkCount < 0 || header.landmarkCount > header.vertexCount ||
+        header.entryCount < 0) {
+        return fail(error, "invalid vertex, landmark or entry count");
+    }
+
+    bool fileDirected = (header.flags & LANDMARK_FLAG_DIRECTED) != 0;
+    uint64_t n = (uint64_t)header.vertexCount;
+    uint64_t k = (uint64_t)header.landmarkCount;
+    uint64_t tables = fileDirected ? 2 : 1;
+    uint64_t entries = k + tables * n * k;
+
+    if (header.bodyBytes != sizeof(int32_t) * entries ||
+        fileSize - sizeof(LandmarkFileHeader) != header.bodyBytes) {
+        return fail(error, "body size does not match the header");
+    }
+
+    // 2) Body, read into temporaries so a bad file leaves *this intact
+    vector<int> newLandmarks(k);
+    vector<int> newFrom(n * k);
+    vector<int> newTo(fileDirected ? n * k : 0);
+    in.read(reinterpret_cast<char*>(newLandmarks.data()), sizeof(int32_t) * newLandmarks.size());
+    in.read(reinterpret_cast<char*>(newFrom.data()), sizeof(int32_t) * newFrom.size());
+    in.read(reinterpret_cast<char*>(newTo.data()), sizeof(int32_t) * newTo.size());
+    if (!in) return fail(error, "unexpected end of file");
+
+    uint64_t hash = FNV_OFFSET_BASIS;
+    hash = updateChecksum(hash, newLandmarks.data(), sizeof(int32_t) * newLandmarks.size());
+    hash = updateChecksum(hash, newFrom.data(), sizeof(int32_t) * newFrom.size());
+    hash = updateChecksum(hash, newTo.data(), sizeof(int32_t) * newTo.size());
+    if (hash != header.checksum) return fail(error, "checksum mismatch");
+
+    // 3) Value ranges
+    for (int L : newLandmarks) {
+        if (L < 0 || (uint64_t)L >= n) return fail(error, "landmark vertex out of range");
+    }
+    for (int d : newFrom) {
+        if (d < -1) return fail(error, "invalid distance entry");
+    }
+    for (int d : newTo) {
+        if (d < -1) return fail(error, "invalid distance entry");
+    }
+
+    V = (int)n;
+    directed = fileDirected;
+    graphEntries = header.entryCount;
+    landmarks.swap(newLandmarks);
+    fromLandmark.swap(newFrom);
+    toLandmark.swap(newTo);
+    return true;
+}
+
+// Function: matchesGraph
+// Parameters:
+// const IGraph& graph - candidate graph
+// Output:
+// Returns true if graph has the indexed size, direction and entry count
+bool LandmarkDistanceOracle::matchesGraph(const IGraph& graph) const {
+    if (graph.getVertexCount() != V || graph.isDirected() != directed) return false;
+
+    long long entries = 0;
+    for (int v = 0; v < V; v++) entries += graph.getOutDegree(v);
+    return entries == graphEntries;
+}
+
+// Function: getLandmarks
+// Parameters:
+// None
+// Output:
+// Returns the chosen landmark vertices
+const vector<int>& LandmarkDistanceOracle::getLandmarks() const {
+    return landmarks;
+}
+
+// Function: getVertexCount
+// Parameters:
+// None
+// Output:
+// Returns the vertex count of the indexed graph
+int LandmarkDistanceOracle::getVertexCount() const {
+    return V;
+}
@@ -11,23 +11,183 @@
 
 #include "List_Implementation_Graph.h"
 
-// Function: isValidVertex
+// Function: ListGraph (Constructor)
+// Parameters:
+// int vertices - number of vertices
+// bool isDirected - true if graph is directed, false if undirected
+// Output:
+// Builds an empty adjacency list graph
+ListGraph::ListGraph(int vertices, bool isDirected)
+    : V(vertices),
+      directed(isDirected),
+      adj(vertices),
+      inDegree(vertices, 0),
+      weighted(false),
+      tracking(false),
+      edgeCount(0),
+      cycleSeen(false) {}
+
+// Function: ListGraph (Constructor)
 // Parameters:
-// int v - vertex index
+// int vertices - number of vertices
+// bool isDirected - true if graph is directed, false if undirected
+// vector<vector<int>>&& adjacency - ready-made neighbor lists
 // Output:
-// Returns true if v is within [0, V-1], otherwise false
-bool ListGraph::isValidVertex(int v) const {
-    return v >= 0 && v < V;
+// Takes ownership of adjacency and derives the in-degree counters
+// Notes:
+// - Entries outside [0, V-1] are not allowed
+ListGraph::ListGraph(int vertices, bool isDirected, vector<vector<int>>&& adjacency)
+    : V(vertices),
+      directed(isDirected),
+      adj(move(adjacency)),
+      inDegree(vertices, 0),
+      weighted(false),
+      tracking(false),
+      edgeCount(0),
+      cycleSeen(false) {
+    adj.resize(V);
+    for (int u = 0; u < V; u++) {
+        for (int v : adj[u]) inDegree[v]++;
+    }
 }
 
 // Function: ListGraph (Constructor)
 // Parameters:
 // int vertices - number of vertices
 // bool isDirected - true if graph is directed, false if undirected
+// vector<vector<int>>&& adjacency - ready-made neighbor lists
+// vector<vector<EdgeWeight>>&& rowWeights - weight of every entry
 // Output:
-// Builds an empty adjacency list graph
-ListGraph::ListGraph(int vertices, bool isDirected)
-    : V(vertices), directed(isDirected), adj(vertices) {}
+// Takes ownership of both list sets and derives the in-degrees
+ListGraph::ListGraph(int vertices,
+                     bool isDirected,
+                     vector<vector<int>>&& adjacency,
+                     vector<vector<EdgeWeight>>&& rowWeights)
+    : ListGraph(vertices, isDirected, move(adjacency)) {
+    weighted = true;
+    weights = move(rowWeights);
+    weights.resize(V);
+    for (int u = 0; u < V; u++) weights[u].resize(adj[u].size(), 1);
+}
+
+// Function: enableWeights
+// Parameters:
+// None
+// Output:
+// Gives every stored entry weight 1 and marks the graph weighted
+void ListGraph::enableWeights() {
+    if (weighted) return;
+
+    weights.assign(V, {});
+    for (int u = 0; u < V; u++) weights[u].assign(adj[u].size(), 1);
+    weighted = true;
+}
+
+// Function: trackEdge
+// Parameters:
+// int u - one endpoint
+// int v - other endpoint
+// Output:
+// Counts the edge and merges the components of u and v
+// Notes:
+// - An edge inside one component closes a cycle
+void ListGraph::trackEdge(int u, int v) {
+    edgeCount++;
+    if (!components.unite(u, v)) cycleSeen = true;
+}
+
+// Function: enableConnectivityTracking
+// Parameters:
+// None
+// Output:
+// Builds the union-find from the stored edges and turns tracking on
+// Notes:
+// - Undirected edges are stored twice, so only the u <= v entry of
+//   each is replayed
+void ListGraph::enableConnectivityTracking() {
+    if (tracking) return;
+
+    components.reset(V);
+    edgeCount = 0;
+    cycleSeen = false;
+
+    for (int u = 0; u < V; u++) {
+        for (int v : adj[u]) {
+            if (directed || u <= v) trackEdge(u, v);
+        }
+    }
+
+    tracking = true;
+}
+
+// Function: isTrackingConnectivity
+// Parameters:
+// None
+// Output:
+// Returns true if incremental connectivity is on
+bool ListGraph::isTrackingConnectivity() const {
+    return tracking;
+}
+
+// Function: getComponentCount
+// Parameters:
+// None
+// Output:
+// Returns the number of components, or -1 when tracking is off
+int ListGraph::getComponentCount() const {
+    return tracking ? components.setCount() : -1;
+}
+
+// Function: inSameComponent
+// Parameters:
+// int u - vertex
+// int v - vertex
+// Output:
+// Returns true if u and v share a component
+bool ListGraph::inSameComponent(int u, int v) const {
+    if (!tracking || !isValidVertex(u) || !isValidVertex(v)) return false;
+    return components.connected(u, v);
+}
+
+// Function: getEdgeCount
+// Parameters:
+// None
+// Output:
+// Returns the edge count, or -1 when tracking is off
+long long ListGraph::getEdgeCount() const {
+    return tracking ? edgeCount : -1;
+}
+
+// Function: hasTrackedCycle
+// Parameters:
+// None
+// Output:
+// Returns the cycle flag (false when tracking is off)
+bool ListGraph::hasTrackedCycle() const {
+    return tracking && cycleSeen;
+}
+
+// Function: ensureReverseAdjacency
+// Parameters:
+// None
+// Output:
+// Builds reverseAdj[v] = all u such that u -> v exists
+// Notes:
+// - Built at most once between two calls to addEdge
+// - Sources are appended in ascending order of u
+const vector<vector<int>>& ListGraph::ensureReverseAdjacency() const {
+    return reverseAdj.get([this](vector<vector<int>>& rows) {
+        rows.assign(V, {});
+        for (int v = 0; v < V; v++) {
+            rows[v].reserve(inDegree[v]);
+        }
+        for (int u = 0; u < V; u++) {
+            for (int v : adj[u]) {
+                rows[v].push_back(u);
+            }
+        }
+    });
+}
 
 // Function: addEdge
 // Parameters:
@@ -37,18 +197,57 @@ ListGraph::ListGraph(int vertices, bool isDirected)
 // Returns true if edge is added successfully, false if invalid vertices
 // Notes:
 // - Undirected graphs store both (u,v) and (v,u)
+// - Drops any cached reverse adjacency
+// - Updates the incremental connectivity state when it is on
 bool ListGraph::addEdge(int u, int v) {
     if (!isValidVertex(u) || !isValidVertex(v)) return false;
 
     adj[u].push_back(v);
+    inDegree[v]++;
+    if (weighted) weights[u].push_back(1);
 
     if (!directed && u != v) {
         adj[v].push_back(u);
+        inDegree[u]++;
+        if (weighted) weights[v].push_back(1);
     }
 
+    if (tracking) trackEdge(u, v);
+
+    reverseAdj.reset();
+
+    return true;
+}
+
+// Function: addWeightedEdge
+// Parameters:
+// int u - source vertex
+// int v - destination vertex
+// EdgeWeight w - edge weight (must be >= 0)
+// Output:
+// Returns true if edge is added, false if a vertex or w is invalid
+// Notes:
+// - The first call switches the graph to weighted storage
+bool ListGraph::addWeightedEdge(int u, int v, EdgeWeight w) {
+    if (!isValidVertex(u) || !isValidVertex(v) || w < 0) return false;
+
+    enableWeights();
+    addEdge(u, v);
+
+    weights[u].back() = w;
+    if (!directed && u != v) weights[v].back() = w;
     return true;
 }
 
+// Function: isWeighted
+// Parameters:
+// None
+// Output:
+// Returns true once the graph stores edge weights
+bool ListGraph::isWeighted() const {
+    return weighted;
+}
+
 // Function: display
 // Parameters:
 // None
@@ -57,14 +256,17 @@ bool ListGraph::addEdge(int u, int v) {
 //   u: v1 -> v2 -> ... -> NULL
 // Notes:
 // - Output format is for readability only
+// - Weighted graphs print every entry as v(w)
 void ListGraph::display() const {
     cout << "Adjacency List:" << endl;
 
     for (int i = 0; i < V; i++) {
         cout << i << ": ";
 
-        for (int v : adj[i]) {
-            cout << v << " -> ";
+        for (size_t k = 0; k < adj[i].size(); k++) {
+            cout << adj[i][k];
+            if (weighted) cout << "(" << weights[i][k] << ")";
+            cout << " -> ";
         }
 
         cout << "NULL" << endl;
@@ -99,6 +301,43 @@ vector<int> ListGraph::getNeighbors(int u) const {
     return adj[u];
 }
 
+// Function: forEachNeighbor
+// Parameters:
+// int u - vertex to query
+// NeighborVisitor visit - callback receiving each neighbor
+// Output:
+// Calls visit(v) for each stored neighbor, stopping if it returns false
+// Notes:
+// - Delegates to the inline template version
+void ListGraph::forEachNeighbor(int u, NeighborVisitor visit) const {
+    forEachNeighbor<NeighborVisitor&>(u, visit);
+}
+
+// Function: forEachWeightedNeighbor
+// Parameters:
+// int u - vertex to query
+// WeightedNeighborVisitor visit - callback receiving (neighbor, weight)
+// Output:
+// Calls visit(v, w) for each stored entry, stopping if it returns false
+// Notes:
+// - Delegates to the inline template version
+void ListGraph::forEachWeightedNeighbor(int u, WeightedNeighborVisitor visit) const {
+    forEachWeightedNeighbor<WeightedNeighborVisitor&>(u, visit);
+}
+
+// Function: forEachInNeighbor
+// Parameters:
+// int u - vertex to query
+// NeighborVisitor visit - callback receiving each in-neighbor
+// Output:
+// Calls visit(w) for every edge w -> u, stopping if it returns false
+// Notes:
+// - Undirected graphs are symmetric, so this reuses adj directly
+// - Delegates to the inline template version
+void ListGraph::forEachInNeighbor(int u, NeighborVisitor visit) const {
+    forEachInNeighbor<NeighborVisitor&>(u, visit);
+}
+
 // Function: getOutDegree
 // Parameters:
 // int v - vertex to query
@@ -117,15 +356,8 @@ int ListGraph::getOutDegree(int v) const {
 // Output:
 // Returns in-degree of v (0 if invalid)
 // Notes:
-// - Runs in O(V + E) time
+// - Counter is maintained by addEdge, so this is O(1)
 int ListGraph::getInDegree(int v) const {
     if (!isValidVertex(v)) return 0;
-
-    int count = 0;
-    for (int u = 0; u < V; u++) {
-        for (int x : adj[u]) {
-            if (x == v) count++;
-        }
-    }
-    return count;
+    return inDegree[v];
 }
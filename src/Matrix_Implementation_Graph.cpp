@@ -5,33 +5,35 @@
 //   Provides edge insertion, display, neighbor queries, and degree calculations.
 //
 // Notes:
-//   - getNeighbors scans a full row (O(V))
-//   - getOutDegree scans a full row (O(V))
-//   - getInDegree scans a full column (O(V))
+//   - The matrix is a single bitset of 64-bit words, V*V bits
+//     (about V*V/2 bits in upper-triangle mode)
+//   - getNeighbors scans a row word by word with count-trailing-zeros
+//   - getOutDegree is a popcount over one row (O(V/64))
+//   - getInDegree reads a cached column count (O(1))
 //   - Best for dense graphs or when you need fast edge existence checks
 //***************************************************************
 
 #include "Matrix_Implementation_Graph.h"
 
-// Function: isValidVertex
-// Parameters:
-// int v - vertex index
-// Output:
-// Returns true if v is within [0, V-1], otherwise false
-bool MatrixGraph::isValidVertex(int v) const {
-    return v >= 0 && v < V;
-}
-
 // Function: MatrixGraph (Constructor)
 // Parameters:
 // int vertices - number of vertices
 // bool isDirected - true if graph is directed, false if undirected
+// bool upperTriangleOnly - store each undirected pair once
 // Output:
 // Builds an empty adjacency matrix graph (all zeros)
-MatrixGraph::MatrixGraph(int vertices, bool isDirected)
+// Notes:
+// - upperTriangleOnly is ignored for directed graphs
+MatrixGraph::MatrixGraph(int vertices, bool isDirected, bool upperTriangleOnly)
     : V(vertices),
       directed(isDirected),
-      matrix(vertices, vector<int>(vertices, 0)) {}
+      upperTriangle(upperTriangleOnly && !isDirected),
+      wordsPerRow(((size_t)(vertices > 0 ? vertices : 0) + 63) / 64),
+      inDegree(vertices > 0 ? vertices : 0, 0) {
+    size_t n = (size_t)(vertices > 0 ? vertices : 0);
+    size_t totalBits = upperTriangle ? n * (n + 1) / 2 : n * wordsPerRow * 64;
+    bits.assign((totalBits + 63) / 64, 0);
+}
 
 // Function: addEdge
 // Parameters:
@@ -41,18 +43,47 @@ MatrixGraph::MatrixGraph(int vertices, bool isDirected)
 // Returns true if edge is added successfully, false if invalid vertices
 // Notes:
 // - Undirected graphs store both (u,v) and (v,u)
+// - Adding an existing edge again changes nothing
 bool MatrixGraph::addEdge(int u, int v) {
     if (!isValidVertex(u) || !isValidVertex(v)) return false;
 
-    matrix[u][v] = 1;
+    size_t index = bitIndex(u, v);
+    if (testBit(index)) return true;
 
-    if (!directed) {
-        matrix[v][u] = 1;
+    bits[index >> 6] |= 1ULL << (index & 63);
+    inDegree[v]++;
+
+    if (!directed && u != v) {
+        if (!upperTriangle) {
+            size_t mirror = bitIndex(v, u);
+            bits[mirror >> 6] |= 1ULL << (mirror & 63);
+        }
+        inDegree[u]++;
     }
 
     return true;
 }
 
+// Function: hasEdge
+// Parameters:
+// int u - source vertex
+// int v - destination vertex
+// Output:
+// Returns true if edge u -> v exists, false otherwise or if invalid
+bool MatrixGraph::hasEdge(int u, int v) const {
+    if (!isValidVertex(u) || !isValidVertex(v)) return false;
+    return testBit(bitIndex(u, v));
+}
+
+// Function: isUpperTriangleOnly
+// Parameters:
+// None
+// Output:
+// Returns true for undirected graphs built in upper-triangle mode
+bool MatrixGraph::isUpperTriangleOnly() const {
+    return upperTriangle;
+}
+
 // Function: display
 // Parameters:
 // None
@@ -65,7 +96,7 @@ void MatrixGraph::display() const {
 
     for (int i = 0; i < V; i++) {
         for (int j = 0; j < V; j++) {
-            cout << matrix[i][j] << " ";
+            cout << (testBit(bitIndex(i, j)) ? 1 : 0) << " ";
         }
         cout << endl;
     }
@@ -95,15 +126,50 @@ bool MatrixGraph::isDirected() const {
 // Output:
 // Returns a vector of neighbors of u (empty if u is invalid)
 vector<int> MatrixGraph::getNeighbors(int u) const {
-    if (!isValidVertex(u)) return {};
-
     vector<int> neighbors;
-    for (int v = 0; v < V; v++) {
-        if (matrix[u][v] != 0) neighbors.push_back(v);
-    }
+    forEachNeighbor(u, [&](int v) { neighbors.push_back(v); });
     return neighbors;
 }
 
+// Function: forEachNeighbor
+// Parameters:
+// int u - vertex to query
+// NeighborVisitor visit - callback receiving each neighbor
+// Output:
+// Calls visit(v) for each set cell in row u (ascending v),
+// stopping if it returns false
+// Notes:
+// - Delegates to the inline template version
+void MatrixGraph::forEachNeighbor(int u, NeighborVisitor visit) const {
+    forEachNeighbor<NeighborVisitor&>(u, visit);
+}
+
+// Function: forEachWeightedNeighbor
+// Parameters:
+// int u - vertex to query
+// WeightedNeighborVisitor visit - callback receiving (neighbor, weight)
+// Output:
+// Calls visit(v, 1) for every neighbor v, stopping if it returns false
+// Notes:
+// - Delegates to the inline template version
+void MatrixGraph::forEachWeightedNeighbor(int u, WeightedNeighborVisitor visit) const {
+    forEachWeightedNeighbor<WeightedNeighborVisitor&>(u, visit);
+}
+
+// Function: forEachInNeighbor
+// Parameters:
+// int u - vertex to query
+// NeighborVisitor visit - callback receiving each in-neighbor
+// Output:
+// Calls visit(w) for every edge w -> u (ascending w),
+// stopping if it returns false
+// Notes:
+// - Undirected matrices are symmetric, so this scans row u instead
+// - Delegates to the inline template version
+void MatrixGraph::forEachInNeighbor(int u, NeighborVisitor visit) const {
+    forEachInNeighbor<NeighborVisitor&>(u, visit);
+}
+
 // Function: getOutDegree
 // Parameters:
 // int v - vertex to query
@@ -111,12 +177,16 @@ vector<int> MatrixGraph::getNeighbors(int u) const {
 // Returns out-degree of v (0 if invalid)
 // Notes:
 // - For undirected graphs, this equals the degree of v
+// - Full mode: popcount over the row words
+// - Upper-triangle mode: the cached column count (graph is symmetric)
 int MatrixGraph::getOutDegree(int v) const {
     if (!isValidVertex(v)) return 0;
+    if (upperTriangle) return inDegree[v];
 
+    const uint64_t* row = bits.data() + (size_t)v * wordsPerRow;
     int count = 0;
-    for (int j = 0; j < V; j++) {
-        if (matrix[v][j] != 0) count++;
+    for (size_t w = 0; w < wordsPerRow; w++) {
+        count += __builtin_popcountll(row[w]);
     }
     return count;
 }
@@ -128,12 +198,8 @@ int MatrixGraph::getOutDegree(int v) const {
 // Returns in-degree of v (0 if invalid)
 // Notes:
 // - For undirected graphs, this will match out-degree
+// - Maintained by addEdge, so this is O(1)
 int MatrixGraph::getInDegree(int v) const {
     if (!isValidVertex(v)) return 0;
-
-    int count = 0;
-    for (int i = 0; i < V; i++) {
-        if (matrix[i][v] != 0) count++;
-    }
-    return count;
+    return inDegree[v];
 }
@@ -0,0 +1,120 @@
+//***************************************************************
+// File: Multi_Source_BFS.cpp
+// Description:
+//   Implements the bit-parallel multi-source BFS declared in
+//   Multi_Source_BFS.h.
+//
+// Notes:
+//   - The per-batch kernel lives in Multi_Source_BFS_Engine.h; this
+//     file splits the sources into batches and collects the results
+//***************************************************************
+
+#include "Multi_Source_BFS.h"
+#include "Graph_Dispatch.h"
+#include "Parallel_Utils.h"
+#include "Multi_Source_BFS_Engine.h"
+
+#include <atomic>
+using namespace std;
+
+namespace {
+
+// Function: runBatches
+// Parameters:
+// const G& graph - concrete graph type
+// const vector<int>& sources - all sources
+// int threads - worker count (0 = automatic)
+// OnReach&& onReach - callable onReach(int first, int v, uint64_t bits, int level)
+// Output:
+// Splits sources into batches of 64 and runs them on the workers;
+// first is the index in sources of the batch's bit 0
+template <typename G, typename OnReach>
+void runBatches(const G& graph,
+                const vector<int>& sources,
+                int threads,
+                OnReach&& onReach) {
+    int V = graph.getVertexCount();
+    int batches = ((int)sources.size() + MULTI_SOURCE_BATCH - 1) / MULTI_SOURCE_BATCH;
+    if (batches == 0 || V == 0) return;
+
+    int workers = min(resolveThreadCount(threads), batches);
+    atomic<int> nextBatch(0);
+
+    parallelForEachWorker(workers, [&](int, int) {
+        MultiSourceBFSWorkspace ws;
+        ws.reset(V);
+
+        while (true) {
+            int batch = nextBatch.fetch_add(1, memory_order_relaxed);
+            if (batch >= batches) break;
+
+            int first = batch * MULTI_SOURCE_BATCH;
+            int count = min(MULTI_SOURCE_BATCH, (int)sources.size() - first);
+
+            runMultiSourceBatch(graph, sources.data() + first, count, ws,
+                                [&](int v, uint64_t bits, int level) {
+                                    onReach(first, v, bits, level);
+                                });
+        }
+    });
+}
+
+} // namespace
+
+// Function: multiSourceBFSDistances
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// const vector<int>& sources - start vertices
+// vector<vector<int>>& distances - output distance arrays
+// const MultiSourceBFSOptions& options - thread count
+// Output:
+// Fills distances[i][v] for every source i and vertex v
+// Notes:
+// - Batches write disjoint rows, so workers need no synchronization
+void multiSourceBFSDistances(const IGraph& graph,
+                             const vector<int>& sources,
+                             vector<vector<int>>& distances,
+                             const MultiSourceBFSOptions& options) {
+    int V = graph.getVertexCount();
+    distances.assign(sources.size(), vector<int>(V, -1));
+
+    dispatchGraph(graph, [&](const auto& g) {
+        runBatches(g, sources, options.threads,
+                   [&](int first, int v, uint64_t bits, int level) {
+                       forEachSetBit(bits, [&](int bit) {
+                           distances[first + bit][v] = level;
+                       });
+                   });
+    });
+}
+
+// Function: multiSourceBFSStats
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// const vector<int>& sources - start vertices
+// const MultiSourceBFSOptions& options - thread count
+// Output:
+// Returns reached count, distance sum and eccentricity per source
+// Notes:
+// - Levels only grow during a batch, so the last level seen by a
+//   source is its eccentricity
+vector<SourceDistanceStats> multiSourceBFSStats(const IGraph& graph,
+                                                const vector<int>& sources,
+                                                const MultiSourceBFSOptions& options) {
+    vector<SourceDistanceStats> stats(sources.size());
+    for (size_t i = 0; i < sources.size(); i++) stats[i].source = sources[i];
+
+    dispatchGraph(graph, [&](const auto& g) {
+        runBatches(g, sources, options.threads,
+                   [&](int first, int, uint64_t bits, int level) {
+                       forEachSetBit(bits, [&](int bit) {
+                           SourceDistanceStats& s = stats[first + bit];
+                           s.reached++;
+                           s.distanceSum += level;
+                           s.eccentricity = level;
+                       });
+                   });
+    });
+
+    return stats;
+}
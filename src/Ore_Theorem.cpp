@@ -20,17 +20,19 @@ using namespace std;
 static bool detectSimple_Ore(const IGraph& g) {
     int n = g.getVertexCount();
 
-    for (int u = 0; u < n; u++) {
-        vector<int> nbrs = g.getNeighbors(u);
-        unordered_set<int> seen;
+    bool simple = true;
+    unordered_set<int> seen;
 
-        for (int v : nbrs) {
-            if (v == u) return false;         // self-loop
-            if (seen.count(v)) return false;  // parallel edge
-            seen.insert(v);
-        }
+    for (int u = 0; u < n && simple; u++) {
+        seen.clear();
+
+        g.forEachNeighbor(u, [&](int v) {
+            if (v == u) simple = false;                       // self-loop
+            else if (!seen.insert(v).second) simple = false;  // parallel edge
+            return simple;
+        });
     }
-    return true;
+    return simple;
 }
 
 // Function: buildAdjMatrix_Ore
@@ -44,16 +46,16 @@ static vector<vector<char>> buildAdjMatrix_Ore(const IGraph& g) {
     int n = g.getVertexCount();
     vector<vector<char>> adj(n, vector<char>(n, 0));
 
+    bool directed = g.isDirected();
     for (int u = 0; u < n; u++) {
-        vector<int> nbrs = g.getNeighbors(u);
-        for (int v : nbrs) {
-            if (v < 0 || v >= n) continue;
+        g.forEachNeighbor(u, [&](int v) {
+            if (v < 0 || v >= n) return;
             adj[u][v] = 1;
 
-            if (!g.isDirected()) {
+            if (!directed) {
                 adj[v][u] = 1;
             }
-        }
+        });
     }
 
     return adj;
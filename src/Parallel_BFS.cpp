@@ -0,0 +1,183 @@
+//***************************************************************
+// File: Parallel_BFS.cpp
+// Description:
+//   Implements the level-synchronous parallel BFS declared in
+//   Parallel_BFS.h.
+//
+// Per level:
+//   1) Workers pull blocks of the frontier through an atomic counter
+//   2) For every edge u -> v: a CAS -1 -> level+1 on distance[v]
+//      claims v (the winner appends v to its own buffer); then, if v
+//      belongs to the next level, parent[v] = min(parent[v], u)
+//   3) The per-thread buffers are concatenated into the next frontier
+//
+// Notes:
+//   - Distance and parent live in atomic arrays during the search and
+//     are copied to the output vectors at the end
+//   - With one worker the atomics fall back to plain load/store
+//***************************************************************
+
+#include "Parallel_BFS.h"
+#include "Graph_Dispatch.h"
+#include "Parallel_Utils.h"
+
+#include <atomic>
+#include <memory>
+#include <algorithm>
+using namespace std;
+
+namespace {
+
+// Frontier vertices handed to a worker per atomic fetch
+const int FRONTIER_BLOCK = 256;
+
+// Function: claimVertex
+// Parameters:
+// atomic<int>& distance - distance slot of the vertex (seen as -1)
+// int level - level to assign
+// bool shared - true when other workers run concurrently
+// Output:
+// Returns true if this call moved the vertex from -1 to level
+inline bool claimVertex(atomic<int>& distance, int level, bool shared) {
+    if (!shared) {
+        distance.store(level, memory_order_relaxed);
+        return true;
+    }
+    int expected = -1;
+    return distance.compare_exchange_strong(expected, level, memory_order_relaxed);
+}
+
+// Function: lowerParent
+// Parameters:
+// atomic<int>& parent - parent slot of the vertex
+// int u - candidate parent
+// bool shared - true when other workers run concurrently
+// Output:
+// Stores u if it is smaller than the current parent (or none is set)
+inline void lowerParent(atomic<int>& parent, int u, bool shared) {
+    int current = parent.load(memory_order_relaxed);
+    if (!shared) {
+        if (current == -1 || u < current) parent.store(u, memory_order_relaxed);
+        return;
+    }
+    while ((current == -1 || u < current) &&
+           !parent.compare_exchange_weak(current, u, memory_order_relaxed)) {
+    }
+}
+
+// Function: parallelBFS
+// Parameters:
+// const G& graph - concrete graph type
+// int start - starting vertex
+// vector<int>& distance - output distances
+// vector<int>& parent - output parents
+// const ParallelBFSOptions& options - thread count and tuning
+// Output:
+// Runs the level-synchronous BFS and fills the outputs
+template <typename G>
+void parallelBFS(const G& graph,
+                 int start,
+                 vector<int>& distance,
+                 vector<int>& parent,
+                 const ParallelBFSOptions& options) {
+    int V = graph.getVertexCount();
+
+    if (V == 0 || start < 0 || start >= V) {
+        distance.clear();
+        parent.clear();
+        return;
+    }
+
+    int threads = resolveThreadCount(options.threads);
+
+    unique_ptr<atomic<int>[]> dist(new atomic<int>[V]);
+    unique_ptr<atomic<int>[]> par(new atomic<int>[V]);
+    parallelFor(0, V, threads, [&](int, long long lo, long long hi) {
+        for (long long v = lo; v < hi; v++) {
+            dist[v].store(-1, memory_order_relaxed);
+            par[v].store(-1, memory_order_relaxed);
+        }
+    });
+    dist[start].store(0, memory_order_relaxed);
+
+    vector<int> frontier(1, start);
+    vector<vector<int>> buffers(threads);
+    int level = 0;
+
+    while (!frontier.empty()) {
+        int workers = (int)frontier.size() < options.minParallelFrontier ? 1 : threads;
+        bool shared = workers > 1;
+        int nextLevel = level + 1;
+        atomic<size_t> nextBlock(0);
+
+        // 1) Expand the frontier
+        parallelForEachWorker(workers, [&](int worker, int) {
+            vector<int>& out = buffers[worker];
+            out.clear();
+
+            while (true) {
+                size_t first = nextBlock.fetch_add(FRONTIER_BLOCK, memory_order_relaxed);
+                if (first >= frontier.size()) break;
+                size_t last = min(frontier.size(), first + FRONTIER_BLOCK);
+
+                for (size_t i = first; i < last; i++) {
+                    int u = frontier[i];
+                    graph.forEachNeighbor(u, [&](int v) {
+                        if (v < 0 || v >= V) return;
+
+                        int d = dist[v].load(memory_order_relaxed);
+                        if (d == -1) {
+                            if (claimVertex(dist[v], nextLevel, shared)) out.push_back(v);
+                            d = nextLevel;  // claimed by this or another worker
+                        }
+                        if (d == nextLevel) lowerParent(par[v], u, shared);
+                    });
+                }
+            }
+        });
+
+        // 2) Concatenate the per-thread buffers
+        size_t total = 0;
+        for (int w = 0; w < workers; w++) total += buffers[w].size();
+
+        frontier.resize(total);
+        size_t position = 0;
+        for (int w = 0; w < workers; w++) {
+            copy(buffers[w].begin(), buffers[w].end(), frontier.begin() + position);
+            position += buffers[w].size();
+        }
+
+        level = nextLevel;
+    }
+
+    // 3) Copy out
+    distance.resize(V);
+    parent.resize(V);
+    parallelFor(0, V, threads, [&](int, long long lo, long long hi) {
+        for (long long v = lo; v < hi; v++) {
+            distance[v] = dist[v].load(memory_order_relaxed);
+            parent[v] = par[v].load(memory_order_relaxed);
+        }
+    });
+}
+
+} // namespace
+
+// Function: parallelBFSShortestPaths
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - starting vertex
+// vector<int>& distance - output distances
+// vector<int>& parent - output parents
+// const ParallelBFSOptions& options - thread count and tuning
+// Output:
+// Dispatches on the concrete graph type and runs the parallel BFS
+void parallelBFSShortestPaths(const IGraph& graph,
+                              int start,
+                              vector<int>& distance,
+                              vector<int>& parent,
+                              const ParallelBFSOptions& options) {
+    dispatchGraph(graph, [&](const auto& g) {
+        parallelBFS(g, start, distance, parent, options);
+    });
+}
@@ -0,0 +1,466 @@
+//***************************************************************
+// File: Parallel_Delta_Stepping.cpp
+// Description:
+//   Implements the parallel delta-stepping search declared in
+//   Parallel_Delta_Stepping.h.
+//
+// Ownership:
+//   - Vertices are dealt to workers in blocks of OWNER_BLOCK IDs; only
+//     the owner of v writes distance[v] / parent[v] and keeps v in its
+//     own ring of buckets, so no atomics are needed on them
+//   - Relaxing an edge u -> v sends a request (distance, v, u) to the
+//     per-thread outbox for v's owner; owners apply their requests in
+//     a separate step
+//
+// Per phase (all workers, separated by ThreadBarrier rounds):
+//   1) Every owner takes the vertices of the current bucket
+//   2) Workers pull blocks of those vertices through an atomic counter
+//      and relax their light (or, once the bucket stays empty, heavy)
+//      edges into the outboxes
+//   3) Every owner applies the requests addressed to it: a smaller
+//      distance wins; among equal distances set in the same step the
+//      smaller sender ID wins, which keeps parent deterministic
+//
+// Notes:
+//   - Distances only change in step 3 and are only read across owners
+//     in step 2, so plain vectors are safe between barriers
+//   - All live distances lie within the largest weight of the current
+//     bucket, so a ring of maxWeight / delta + 2 buckets suffices
+//   - Threads are spawned once per search, not once per phase
+//***************************************************************
+
+#include "Parallel_Delta_Stepping.h"
+#include "Graph_Dispatch.h"
+#include "Parallel_Utils.h"
+
+#include <atomic>
+#include <limits>
+#include <algorithm>
+using namespace std;
+
+namespace {
+
+// Frontier vertices handed to a worker per atomic fetch
+const int FRONTIER_BLOCK = 256;
+
+// Consecutive vertex IDs owned by the same worker (whole cache lines
+// of distance entries)
+const int OWNER_BLOCK = 64;
+
+// Upper bound on the ring size (buckets live at the same time)
+const long long MAX_LIVE_BUCKETS = 65536;
+
+// Internal distance of a vertex not reached yet
+const EdgeWeight UNREACHED = numeric_limits<EdgeWeight>::max();
+
+// Struct: RelaxRequest
+// Purpose:
+//   "distance[vertex] may drop to distance via from", queued for the
+//   owner of vertex.
+struct RelaxRequest {
+    EdgeWeight distance;
+    int vertex;
+    int from;
+};
+
+// Struct: DeltaWorker
+// Purpose:
+//   Buckets, phase lists, outboxes and counters of one worker.
+struct DeltaWorker {
+    vector<vector<int>> ring;               // owned vertices by bucket % ringSize
+    long long queued = 0;                   // entries in ring (stale ones included)
+    long long lowestBucket = -1;            // lowest bucket with queued entries
+    vector<int> current;                    // owned vertices of this phase
+    vector<int> removed;                    // owned vertices taken from this bucket
+    vector<vector<RelaxRequest>> outbox;    // requests by owner
+    DeltaSteppingStats stats;
+};
+
+// Struct: DeltaSearch
+// Purpose:
+//   State shared by all workers of one search.
+struct DeltaSearch {
+    int V = 0;
+    int workers = 1;
+    EdgeWeight delta = 1;
+    long long ringSize = 2;
+    EdgeWeight* distance = nullptr;
+    int* parent = nullptr;
+    vector<long long> takenIn;      // phase in which v was last taken
+    vector<long long> removedFrom;  // bucket v was last taken from
+    vector<long long> updatedIn;    // phase in which distance[v] last dropped
+    vector<DeltaWorker> state;
+};
+
+// Function: ownerOf
+// Parameters:
+// int v - vertex ID
+// int workers - worker count
+// Output:
+// Returns the worker that owns v
+inline int ownerOf(int v, int workers) {
+    return (v / OWNER_BLOCK) % workers;
+}
+
+// Function: enqueue
+// Parameters:
+// DeltaSearch& search - shared state
+// DeltaWorker& me - owner of v
+// int v - vertex whose distance just dropped
+// EdgeWeight d - its new distance
+// Output:
+// Files v under the bucket of d
+void enqueue(DeltaSearch& search, DeltaWorker& me, int v, EdgeWeight d) {
+    long long bucket = d / search.delta;
+    me.ring[bucket % search.ringSize].push_back(v);
+    me.queued++;
+    if (me.lowestBucket == -1 || bucket < me.lowestBucket) me.lowestBucket = bucket;
+}
+
+// Function: nextBucket
+// Parameters:
+// const DeltaSearch& search - shared state
+// DeltaWorker& me - worker to inspect
+// long long done - last bucket processed (-1 before the first)
+// Output:
+// Returns the lowest bucket above done holding entries of me, or -1
+// Notes:
+// - Entries lie in (done, done + ringSize), so the scan is bounded
+long long nextBucket(const DeltaSearch& search, DeltaWorker& me, long long done) {
+    if (me.queued == 0) return -1;
+    if (me.lowestBucket > done) return me.lowestBucket;
+
+    long long bucket = done + 1;
+    while (me.ring[bucket % search.ringSize].empty()) bucket++;
+    me.lowestBucket = bucket;
+    return bucket;
+}
+
+// Function: takeBucket
+// Parameters:
+// DeltaSearch& search - shared state
+// DeltaWorker& me - worker taking its vertices
+// long long bucket - bucket being emptied
+// long long phase - current phase number
+// Output:
+// Moves the live vertices of bucket into me.current (once each) and
+// records first-time removals in me.removed
+void takeBucket(DeltaSearch& search, DeltaWorker& me, long long bucket, long long phase) {
+    vector<int>& slot = me.ring[bucket % search.ringSize];
+    me.queued -= (long long)slot.size();
+    me.current.clear();
+
+    for (int v : slot) {
+        if (search.distance[v] / search.delta != bucket) continue;   // moved lower since
+        if (search.takenIn[v] == phase) continue;                    // duplicate entry
+        search.takenIn[v] = phase;
+        me.current.push_back(v);
+
+        if (search.removedFrom[v] != bucket) {
+            search.removedFrom[v] = bucket;
+            me.removed.push_back(v);
+        }
+    }
+    slot.clear();
+}
+
+// Function: relaxFrontier
+// Parameters:
+// const G& graph - concrete graph type
+// DeltaSearch& search - shared state
+// DeltaWorker& me - worker doing the relaxing
+// bool light - true: edges with weight <= delta, false: heavier ones
+// const vector<size_t>& sizes - frontier length of every owner
+// atomic<size_t>& cursor - shared block counter (starts at 0)
+// Output:
+// Relaxes the chosen edges of the frontier (current lists for light,
+// removed lists for heavy) and fills me.outbox
+template <typename G>
+void relaxFrontier(const G& graph,
+                   DeltaSearch& search,
+                   DeltaWorker& me,
+                   bool light,
+                   const vector<size_t>& sizes,
+                   atomic<size_t>& cursor) {
+    int V = search.V;
+    EdgeWeight delta = search.delta;
+    const EdgeWeight* distance = search.distance;
+
+    size_t total = 0;
+    for (size_t s : sizes) total += s;
+
+    while (true) {
+        size_t first = cursor.fetch_add(FRONTIER_BLOCK, memory_order_relaxed);
+        if (first >= total) break;
+        size_t last = min(total, first + FRONTIER_BLOCK);
+
+        // The frontier is the owner lists laid end to end
+        int owner = 0;
+        size_t offset = 0;
+        for (size_t i = first; i < last; i++) {
+            while (i - offset >= sizes[owner]) offset += sizes[owner++];
+
+            const DeltaWorker& from = search.state[owner];
+            int u = light ? from.current[i - offset] : from.removed[i - offset];
+            EdgeWeight du = distance[u];
+
+            graph.forEachWeightedNeighbor(u, [&](int v, EdgeWeight w) {
+                me.stats.edgesInspected++;
+                if (v < 0 || v >= V || w < 0) return;  // safety guard
+                if ((w <= delta) != light) return;
+
+                EdgeWeight d = du + w;
+                if (d >= distance[v]) return;
+
+                me.outbox[ownerOf(v, search.workers)].push_back({d, v, u});
+                me.stats.requests++;
+            });
+        }
+    }
+}
+
+// Function: applyRequests
+// Parameters:
+// DeltaSearch& search - shared state
+// int worker - ID of the owner applying its requests
+// long long phase - current phase number
+// Output:
+// Applies every request addressed to worker and empties those outboxes
+void applyRequests(DeltaSearch& search, int worker, long long phase) {
+    DeltaWorker& me = search.state[worker];
+
+    for (DeltaWorker& sender : search.state) {
+        vector<RelaxRequest>& box = sender.outbox[worker];
+        for (const RelaxRequest& r : box) {
+            int v = r.vertex;
+            if (r.distance < search.distance[v]) {
+                search.distance[v] = r.distance;
+                search.parent[v] = r.from;
+                search.updatedIn[v] = phase;
+                enqueue(search, me, v, r.distance);
+            } else if (r.distance == search.distance[v] &&
+                       search.updatedIn[v] == phase &&
+                       r.from < search.parent[v]) {
+                search.parent[v] = r.from;
+            }
+        }
+        box.clear();
+    }
+}
+
+// Function: runDeltaStepping
+// Parameters:
+// const G& graph - concrete graph type
+// DeltaSearch& search - prepared shared state (start already queued)
+// DeltaSteppingStats& stats - output counters (summed over workers)
+// Output:
+// Processes buckets in increasing order until none has entries
+template <typename G>
+void runDeltaStepping(const G& graph, DeltaSearch& search, DeltaSteppingStats& stats) {
+    int workers = search.workers;
+    vector<long long> lowest(workers, -1);
+    vector<size_t> lightSizes(workers, 0);
+    vector<size_t> heavySizes(workers, 0);
+    atomic<size_t> lightCursor(0);
+    atomic<size_t> heavyCursor(0);
+    ThreadBarrier barrier(workers);
+
+    parallelForEachWorker(workers, [&](int worker, int) {
+        DeltaWorker& me = search.state[worker];
+        long long done = -1;
+        long long phase = 0;
+
+        while (true) {
+            // Agree on the lowest non-empty bucket
+            lowest[worker] = nextBucket(search, me, done);
+            barrier.wait();
+
+            long long bucket = -1;
+            for (long long b : lowest) {
+                if (b != -1 && (bucket == -1 || b < bucket)) bucket = b;
+            }
+            if (bucket == -1) break;
+            if (worker == 0) me.stats.buckets++;
+            me.removed.clear();
+
+            // Light phases until the bucket stays empty
+            while (true) {
+                phase++;
+                takeBucket(search, me, bucket, phase);
+                lightSizes[worker] = me.current.size();
+                if (worker == 0) lightCursor.store(0, memory_order_relaxed);
+                barrier.wait();
+
+                size_t total = 0;
+                for (size_t s : lightSizes) total += s;
+                if (total == 0) break;
+                if (worker == 0) me.stats.phases++;
+
+                relaxFrontier(graph, search, me, true, lightSizes, lightCursor);
+                barrier.wait();
+                applyRequests(search, worker, phase);
+            }
+
+            // One heavy step over everything removed from the bucket
+            phase++;
+            heavySizes[worker] = me.removed.size();
+            if (worker == 0) heavyCursor.store(0, memory_order_relaxed);
+            barrier.wait();
+
+            size_t total = 0;
+            for (size_t s : heavySizes) total += s;
+            if (total > 0) {
+                if (worker == 0) me.stats.phases++;
+                relaxFrontier(graph, search, me, false, heavySizes, heavyCursor);
+                barrier.wait();
+                applyRequests(search, worker, phase);
+            }
+
+            done = bucket;
+        }
+    });
+
+    for (const DeltaWorker& w : search.state) {
+        stats.buckets += w.stats.buckets;
+        stats.phases += w.stats.phases;
+        stats.edgesInspected += w.stats.edgesInspected;
+        stats.requests += w.stats.requests;
+    }
+}
+
+// Function: scanWeights
+// Parameters:
+// const G& graph - concrete graph type
+// int threads - worker count
+// EdgeWeight& maxWeight - output, largest non-negative edge weight
+// long long& edges - output, number of adjacency entries
+// Output:
+// Reads every edge once to size the buckets
+template <typename G>
+void scanWeights(const G& graph, int threads, EdgeWeight& maxWeight, long long& edges) {
+    int V = graph.getVertexCount();
+    vector<EdgeWeight> maxima(threads, 0);
+    vector<long long> counts(threads, 0);
+
+    parallelFor(0, V, threads, [&](int worker, long long lo, long long hi) {
+        EdgeWeight best = 0;
+        long long count = 0;
+        for (long long u = lo; u < hi; u++) {
+            graph.forEachWeightedNeighbor((int)u, [&](int, EdgeWeight w) {
+                if (w > best) best = w;
+                count++;
+            });
+        }
+        maxima[worker] = best;
+        counts[worker] = count;
+    });
+
+    maxWeight = *max_element(maxima.begin(), maxima.end());
+    edges = 0;
+    for (long long c : counts) edges += c;
+}
+
+// Function: deltaStepping
+// Parameters:
+// const G& graph - concrete graph type
+// int start - starting vertex (valid)
+// vector<EdgeWeight>& distance - output distances
+// vector<int>& parent - output parents
+// const DeltaSteppingOptions& options - thread count and bucket width
+// DeltaSteppingStats& stats - output counters
+// Output:
+// Chooses delta, runs the search and fills the outputs
+template <typename G>
+void deltaStepping(const G& graph,
+                   int start,
+                   vector<EdgeWeight>& distance,
+                   vector<int>& parent,
+                   const DeltaSteppingOptions& options,
+                   DeltaSteppingStats& stats) {
+    int V = graph.getVertexCount();
+    int threads = resolveThreadCount(options.threads);
+
+    EdgeWeight maxWeight = 0;
+    long long edges = 0;
+    scanWeights(graph, threads, maxWeight, edges);
+
+    // Bucket width: requested, or about one bucket per average
+    // out-degree worth of the weight range
+    EdgeWeight delta = options.delta;
+    if (delta <= 0) {
+        long long averageDegree = max<long long>(1, edges / V);
+        delta = max<EdgeWeight>(1, maxWeight / averageDegree);
+    }
+    if (maxWeight / delta + 2 > MAX_LIVE_BUCKETS) {
+        delta = (maxWeight + MAX_LIVE_BUCKETS - 3) / (MAX_LIVE_BUCKETS - 2);
+    }
+    stats.delta = delta;
+
+    distance.resize(V);
+    parent.resize(V);
+    parallelFor(0, V, threads, [&](int, long long lo, long long hi) {
+        fill(distance.begin() + lo, distance.begin() + hi, UNREACHED);
+        fill(parent.begin() + lo, parent.begin() + hi, -1);
+    });
+
+    DeltaSearch search;
+    search.V = V;
+    search.workers = threads;
+    search.delta = delta;
+    search.ringSize = maxWeight / delta + 2;
+    search.distance = distance.data();
+    search.parent = parent.data();
+    search.takenIn.assign(V, -1);
+    search.removedFrom.assign(V, -1);
+    search.updatedIn.assign(V, -1);
+    search.state.resize(threads);
+    for (DeltaWorker& w : search.state) {
+        w.ring.resize(search.ringSize);
+        w.outbox.resize(threads);
+    }
+
+    distance[start] = 0;
+    enqueue(search, search.state[ownerOf(start, threads)], start, 0);
+
+    runDeltaStepping(graph, search, stats);
+
+    parallelFor(0, V, threads, [&](int, long long lo, long long hi) {
+        for (long long v = lo; v < hi; v++) {
+            if (distance[v] == UNREACHED) distance[v] = -1;
+        }
+    });
+}
+
+} // namespace
+
+// Function: deltaSteppingShortestPaths
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - starting vertex
+// vector<EdgeWeight>& distance - output distances
+// vector<int>& parent - output parents
+// const DeltaSteppingOptions& options - thread count and bucket width
+// DeltaSteppingStats* stats - optional work counters
+// Output:
+// Dispatches on the concrete graph type and runs delta-stepping
+void deltaSteppingShortestPaths(const IGraph& graph,
+                                int start,
+                                vector<EdgeWeight>& distance,
+                                vector<int>& parent,
+                                const DeltaSteppingOptions& options,
+                                DeltaSteppingStats* stats) {
+    int V = graph.getVertexCount();
+    DeltaSteppingStats local;
+
+    if (start < 0 || start >= V) {
+        distance.clear();
+        parent.clear();
+        if (stats) *stats = local;
+        return;
+    }
+
+    dispatchGraph(graph, [&](const auto& g) {
+        deltaStepping(g, start, distance, parent, options, local);
+    });
+    if (stats) *stats = local;
+}
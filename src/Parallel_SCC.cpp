@@ -0,0 +1,436 @@
+//***************************************************************
+// File: Parallel_SCC.cpp
+// Description:
+//   Implements the parallel SCC decomposition declared in
+//   Parallel_SCC.h.
+//
+// State:
+//   - owner[v]: a representative vertex of v's SCC once v is assigned,
+//     -1 while v is still in the remaining graph
+//   - color[v]: coloring label (step 4)
+//   - mark[v]: forward-reached (step 2) / queued (step 4) flag
+//   All three are atomic arrays: workers read the flags of any vertex
+//   while others update them.
+//
+// Per step, the vertex list being worked on (remaining vertices, a
+// BFS frontier, the coloring worklist) is split into blocks handed
+// out through an atomic counter; each worker appends its output to
+// its own buffer and the buffers are concatenated afterwards.
+//
+// Notes:
+//   - Trimming reads flags updated in the same round; that only makes
+//     it trim sooner (a vertex whose remaining neighbors on one side
+//     are all singleton SCCs is a singleton SCC itself)
+//   - The backward search of step 2 stays inside the forward set,
+//     since every path inside an SCC does
+//   - Representatives are renumbered by smallest member at the end
+//***************************************************************
+
+#include "Parallel_SCC.h"
+#include "Graph_Dispatch.h"
+#include "Parallel_Utils.h"
+
+#include <atomic>
+#include <memory>
+#include <algorithm>
+using namespace std;
+
+namespace {
+
+// Vertices handed to a worker per atomic fetch
+const int LIST_BLOCK = 256;
+
+// Struct: SCCSearch
+// Purpose:
+//   Arrays and buffers shared by every step of one decomposition.
+struct SCCSearch {
+    int V = 0;
+    int threads = 1;
+    int minParallel = 1;
+    unique_ptr<atomic<int>[]> owner;
+    unique_ptr<atomic<int>[]> color;
+    unique_ptr<atomic<unsigned char>[]> mark;
+    vector<vector<int>> buffers;
+
+    // Function: remaining
+    // Parameters:
+    // int v - vertex ID (valid)
+    // Output:
+    // Returns true if v has no SCC yet
+    bool remaining(int v) const {
+        return owner[v].load(memory_order_relaxed) == -1;
+    }
+};
+
+// Function: expandList
+// Parameters:
+// SCCSearch& search - shared state (buffers)
+// vector<int>& list - input list, replaced by the output
+// F&& expand - callable expand(int u, vector<int>& out)
+// Output:
+// Runs expand on every vertex of list across the workers and replaces
+// list with everything they appended
+template <typename F>
+void expandList(SCCSearch& search, vector<int>& list, F&& expand) {
+    int workers = (int)list.size() < search.minParallel ? 1 : search.threads;
+    atomic<size_t> nextBlock(0);
+
+    parallelForEachWorker(workers, [&](int worker, int) {
+        vector<int>& out = search.buffers[worker];
+        out.clear();
+
+        while (true) {
+            size_t first = nextBlock.fetch_add(LIST_BLOCK, memory_order_relaxed);
+            if (first >= list.size()) break;
+            size_t last = min(list.size(), first + LIST_BLOCK);
+
+            for (size_t i = first; i < last; i++) expand(list[i], out);
+        }
+    });
+
+    size_t total = 0;
+    for (int w = 0; w < workers; w++) total += search.buffers[w].size();
+
+    list.resize(total);
+    size_t position = 0;
+    for (int w = 0; w < workers; w++) {
+        copy(search.buffers[w].begin(), search.buffers[w].end(), list.begin() + position);
+        position += search.buffers[w].size();
+    }
+}
+
+// Function: dropAssigned
+// Parameters:
+// SCCSearch& search - shared state
+// vector<int>& active - remaining vertices (may hold assigned ones)
+// Output:
+// Removes the vertices that have an SCC by now
+void dropAssigned(SCCSearch& search, vector<int>& active) {
+    expandList(search, active, [&](int u, vector<int>& out) {
+        if (search.remaining(u)) out.push_back(u);
+    });
+}
+
+// Function: trim
+// Parameters:
+// const G& graph - concrete graph type
+// SCCSearch& search - shared state
+// vector<int>& active - remaining vertices (updated)
+// Output:
+// Removes singleton SCCs until a round removes nothing; returns how
+// many were removed
+template <typename G>
+long long trim(const G& graph, SCCSearch& search, vector<int>& active) {
+    int V = search.V;
+    long long removed = 0;
+
+    while (!active.empty()) {
+        size_t before = active.size();
+
+        expandList(search, active, [&](int u, vector<int>& out) {
+            bool hasOut = false;
+            graph.forEachNeighbor(u, [&](int w) {
+                if (w < 0 || w >= V || w == u || !search.remaining(w)) return true;
+                hasOut = true;
+                return false;   // one is enough
+            });
+
+            bool hasIn = false;
+            if (hasOut) {
+                graph.forEachInNeighbor(u, [&](int w) {
+                    if (w < 0 || w >= V || w == u || !search.remaining(w)) return true;
+                    hasIn = true;
+                    return false;
+                });
+            }
+
+            if (hasOut && hasIn) {
+                out.push_back(u);
+            } else {
+                search.owner[u].store(u, memory_order_relaxed);
+            }
+        });
+
+        removed += (long long)(before - active.size());
+        if (active.size() == before) break;
+    }
+    return removed;
+}
+
+// Function: pickPivot
+// Parameters:
+// const G& graph - concrete graph type
+// SCCSearch& search - shared state
+// const vector<int>& active - remaining vertices (not empty)
+// Output:
+// Returns the vertex with the largest in-degree x out-degree (smallest
+// ID on ties)
+template <typename G>
+int pickPivot(const G& graph, SCCSearch& search, const vector<int>& active) {
+    vector<int> best(search.threads, -1);
+    vector<long long> bestScore(search.threads, -1);
+
+    parallelFor(0, (long long)active.size(), search.threads, [&](int worker, long long lo, long long hi) {
+        for (long long i = lo; i < hi; i++) {
+            int u = active[i];
+            long long score = (long long)graph.getOutDegree(u) * graph.getInDegree(u);
+            if (score > bestScore[worker] || (score == bestScore[worker] && u < best[worker])) {
+                bestScore[worker] = score;
+                best[worker] = u;
+            }
+        }
+    });
+
+    int pivot = -1;
+    long long pivotScore = -1;
+    for (int w = 0; w < search.threads; w++) {
+        if (best[w] == -1) continue;
+        if (bestScore[w] > pivotScore || (bestScore[w] == pivotScore && best[w] < pivot)) {
+            pivotScore = bestScore[w];
+            pivot = best[w];
+        }
+    }
+    return pivot;
+}
+
+// Function: forwardBackward
+// Parameters:
+// const G& graph - concrete graph type
+// SCCSearch& search - shared state
+// vector<int>& active - remaining vertices (updated)
+// Output:
+// Assigns the SCC of a pivot; returns its size
+template <typename G>
+long long forwardBackward(const G& graph, SCCSearch& search, vector<int>& active) {
+    int V = search.V;
+    int pivot = pickPivot(graph, search, active);
+
+    // Forward: mark everything the pivot reaches
+    vector<int> frontier(1, pivot);
+    search.mark[pivot].store(1, memory_order_relaxed);
+    while (!frontier.empty()) {
+        expandList(search, frontier, [&](int u, vector<int>& out) {
+            graph.forEachNeighbor(u, [&](int w) {
+                if (w < 0 || w >= V || !search.remaining(w)) return;
+                if (search.mark[w].load(memory_order_relaxed) != 0) return;
+                if (search.mark[w].exchange(1, memory_order_relaxed) == 0) out.push_back(w);
+            });
+        });
+    }
+
+    // Backward inside the forward set: those vertices also reach the pivot
+    long long size = 1;
+    frontier.assign(1, pivot);
+    search.owner[pivot].store(pivot, memory_order_relaxed);
+    while (!frontier.empty()) {
+        expandList(search, frontier, [&](int u, vector<int>& out) {
+            graph.forEachInNeighbor(u, [&](int w) {
+                if (w < 0 || w >= V || search.mark[w].load(memory_order_relaxed) == 0) return;
+
+                int expected = -1;
+                if (search.owner[w].compare_exchange_strong(expected, pivot, memory_order_relaxed)) {
+                    out.push_back(w);
+                }
+            });
+        });
+        size += (long long)frontier.size();
+    }
+
+    parallelFor(0, (long long)active.size(), search.threads, [&](int, long long lo, long long hi) {
+        for (long long i = lo; i < hi; i++) search.mark[active[i]].store(0, memory_order_relaxed);
+    });
+    dropAssigned(search, active);
+    return size;
+}
+
+// Function: colorRound
+// Parameters:
+// const G& graph - concrete graph type
+// SCCSearch& search - shared state
+// vector<int>& active - remaining vertices (updated)
+// Output:
+// Runs one coloring round and assigns the SCC of every color root
+template <typename G>
+void colorRound(const G& graph, SCCSearch& search, vector<int>& active) {
+    int V = search.V;
+
+    // 1) Every vertex starts with its own ID and is queued
+    parallelFor(0, (long long)active.size(), search.threads, [&](int, long long lo, long long hi) {
+        for (long long i = lo; i < hi; i++) {
+            int u = active[i];
+            search.color[u].store(u, memory_order_relaxed);
+            search.mark[u].store(1, memory_order_relaxed);
+        }
+    });
+
+    // 2) Push larger colors along out-edges until nothing changes
+    vector<int> worklist = active;
+    while (!worklist.empty()) {
+        // Unqueueing u (mark store, then color load) races with a raise
+        // of color[u] (CAS, then mark exchange). Both pairs must be
+        // seq_cst: with weaker orders the load may miss the new color
+        // while the exchange still sees mark 1, so u is never queued
+        // again, the color stops spreading and an SCC can be split.
+        expandList(search, worklist, [&](int u, vector<int>& out) {
+            search.mark[u].store(0, memory_order_seq_cst);
+            int c = search.color[u].load(memory_order_seq_cst);
+
+            graph.forEachNeighbor(u, [&](int w) {
+                if (w < 0 || w >= V || !search.remaining(w)) return;
+
+                int current = search.color[w].load(memory_order_relaxed);
+                while (c > current) {
+                    if (search.color[w].compare_exchange_weak(current, c, memory_order_seq_cst,
+                                                              memory_order_relaxed)) {
+                        if (search.mark[w].exchange(1, memory_order_seq_cst) == 0) out.push_back(w);
+                        break;
+                    }
+                }
+            });
+        });
+    }
+
+    // 3) Each root collects the vertices of its color that reach it
+    vector<int> roots = active;
+    expandList(search, roots, [&](int u, vector<int>& out) {
+        if (search.color[u].load(memory_order_relaxed) == u) out.push_back(u);
+    });
+
+    int workers = (int)min<size_t>(search.threads, roots.size());
+    atomic<size_t> nextRoot(0);
+    parallelForEachWorker(workers, [&](int, int) {
+        vector<int> stack;
+        while (true) {
+            size_t index = nextRoot.fetch_add(1, memory_order_relaxed);
+            if (index >= roots.size()) break;
+
+            int r = roots[index];
+            search.owner[r].store(r, memory_order_relaxed);
+            stack.assign(1, r);
+
+            while (!stack.empty()) {
+                int u = stack.back();
+                stack.pop_back();
+
+                graph.forEachInNeighbor(u, [&](int w) {
+                    if (w < 0 || w >= V) return;
+                    if (search.color[w].load(memory_order_relaxed) != r || !search.remaining(w)) return;
+
+                    // Only this worker writes vertices of color r
+                    search.owner[w].store(r, memory_order_relaxed);
+                    stack.push_back(w);
+                });
+            }
+        }
+    });
+
+    dropAssigned(search, active);
+}
+
+// Function: parallelSCCTemplate
+// Parameters:
+// const G& graph - concrete graph type
+// vector<int>& componentId - output labels
+// const ParallelSCCOptions& options - thread count and tuning
+// ParallelSCCStats& stats - output counters
+// Output:
+// Runs the four steps and returns the number of SCCs
+template <typename G>
+int parallelSCCTemplate(const G& graph,
+                        vector<int>& componentId,
+                        const ParallelSCCOptions& options,
+                        ParallelSCCStats& stats) {
+    int V = graph.getVertexCount();
+    componentId.assign(V, -1);
+    if (V == 0) return 0;
+
+    SCCSearch search;
+    search.V = V;
+    search.threads = resolveThreadCount(options.threads);
+    search.minParallel = max(1, options.minParallelFrontier);
+    search.owner.reset(new atomic<int>[V]);
+    search.color.reset(new atomic<int>[V]);
+    search.mark.reset(new atomic<unsigned char>[V]);
+    search.buffers.resize(search.threads);
+
+    vector<int> active(V);
+    parallelFor(0, V, search.threads, [&](int, long long lo, long long hi) {
+        for (long long v = lo; v < hi; v++) {
+            search.owner[v].store(-1, memory_order_relaxed);
+            search.color[v].store(-1, memory_order_relaxed);
+            search.mark[v].store(0, memory_order_relaxed);
+            active[v] = (int)v;
+        }
+    });
+
+    // Build any lazily created reverse adjacency before the workers
+    // start asking for it
+    graph.forEachInNeighbor(0, [](int) {});
+
+    // 1) - 4)
+    stats.trimmed += trim(graph, search, active);
+    if (!active.empty()) stats.pivotComponent = forwardBackward(graph, search, active);
+    stats.trimmed += trim(graph, search, active);
+    while (!active.empty()) {
+        stats.coloringRounds++;
+        colorRound(graph, search, active);
+    }
+
+    // Renumber representatives by smallest member
+    vector<int> number(V, -1);
+    int count = 0;
+    for (int v = 0; v < V; v++) {
+        int rep = search.owner[v].load(memory_order_relaxed);
+        if (number[rep] == -1) number[rep] = count++;
+        componentId[v] = number[rep];
+    }
+
+    stats.components = count;
+    return count;
+}
+
+} // namespace
+
+// Function: parallelSCCLabels
+// Parameters:
+// const IGraph& graph - reference to a graph implementing IGraph
+// vector<int>& componentId - output mapping from vertex to SCC index
+// const ParallelSCCOptions& options - thread count and tuning
+// ParallelSCCStats* stats - optional counters
+// Output:
+// Returns the number of SCCs
+int parallelSCCLabels(const IGraph& graph,
+                      vector<int>& componentId,
+                      const ParallelSCCOptions& options,
+                      ParallelSCCStats* stats) {
+    ParallelSCCStats local;
+    int count = dispatchGraph(graph, [&](const auto& g) {
+        return parallelSCCTemplate(g, componentId, options, local);
+    });
+    if (stats) *stats = local;
+    return count;
+}
+
+// Function: parallelSCC
+// Parameters:
+// const IGraph& graph - reference to a graph implementing IGraph
+// vector<int>& componentId - output mapping from vertex to SCC index
+// const ParallelSCCOptions& options - thread count and tuning
+// ParallelSCCStats* stats - optional counters
+// Output:
+// Returns SCC list (each SCC is a vector of vertices)
+vector<vector<int>> parallelSCC(const IGraph& graph,
+                                vector<int>& componentId,
+                                const ParallelSCCOptions& options,
+                                ParallelSCCStats* stats) {
+    int count = parallelSCCLabels(graph, componentId, options, stats);
+
+    vector<int> sizes(count, 0);
+    for (int id : componentId) sizes[id]++;
+
+    vector<vector<int>> sccs(count);
+    for (int i = 0; i < count; i++) sccs[i].reserve(sizes[i]);
+    for (int v = 0; v < (int)componentId.size(); v++) sccs[componentId[v]].push_back(v);
+
+    return sccs;
+}
@@ -0,0 +1,140 @@
+//***************************************************************
+// File: SCC_Pearce.cpp
+// Description:
+//   Implements one-pass Strongly Connected Components (SCC) detection
+//   using Pearce's variant of Tarjan's algorithm (PEA_FIND_SCC2).
+//
+// Steps (per DFSEngine event):
+//   - discover u:          rindex[u] = index++, u is a root candidate
+//   - edge u -> v visited: rindex[u] = min(rindex[u], rindex[v])
+//   - finish u:            if u is still a root, pop its SCC off the
+//                          component stack and label it c--; else push
+//                          u; then lower the parent's rindex by u's
+//
+// Complexity:
+//   - Time:  O(V + E)
+//   - Space: O(V) (labels reuse the rindex array)
+//
+// Notes:
+//   - index is decremented for every labelled vertex, so live indices
+//     stay below every label already given out and finished SCCs
+//     never lower anyone's rindex
+//   - The DFS is the iterative DFSEngine (DFS_Engine.h), dispatched on
+//     the concrete graph type
+//***************************************************************
+
+#include "SCC_Pearce.h"
+#include "Graph_Dispatch.h"
+#include "DFS_Engine.h"
+
+namespace {
+
+// Struct: PearceVisitor
+// Purpose:
+//   DFSEngine visitor carrying the rindex / root / component stack
+//   state of Pearce's algorithm.
+struct PearceVisitor : DFSVisitorBase {
+    vector<int>& rindex;
+    vector<bool> root;
+    vector<int> pending;    // finished non-root vertices of open SCCs
+    int index = 0;
+    int label;
+
+    PearceVisitor(vector<int>& rindexArray, int V)
+        : rindex(rindexArray), root(V, false), label(V - 1) {}
+
+    // Function: lower
+    // Parameters:
+    // int u - vertex to update
+    // int v - vertex reached from u (already discovered)
+    // Output:
+    // Pulls rindex[u] down to rindex[v]
+    void lower(int u, int v) {
+        if (rindex[v] < rindex[u]) {
+            rindex[u] = rindex[v];
+            root[u] = false;
+        }
+    }
+
+    void discoverVertex(int u, int) {
+        rindex[u] = index++;
+        root[u] = true;
+    }
+
+    void backEdge(int u, int v) { lower(u, v); }
+
+    void forwardOrCrossEdge(int u, int v) { lower(u, v); }
+
+    void finishVertex(int u, int parent) {
+        if (root[u]) {
+            index--;
+            while (!pending.empty() && rindex[u] <= rindex[pending.back()]) {
+                rindex[pending.back()] = label;
+                pending.pop_back();
+                index--;
+            }
+            rindex[u] = label;
+            label--;
+        } else {
+            pending.push_back(u);
+        }
+
+        if (parent != -1) lower(parent, u);
+    }
+};
+
+// Function: pearceLabels
+// Parameters:
+// const G& graph - concrete graph type
+// vector<int>& componentId - output labels
+// Output:
+// Labels every vertex and returns the number of SCCs
+template <typename G>
+int pearceLabels(const G& graph, vector<int>& componentId) {
+    int V = graph.getVertexCount();
+    componentId.assign(V, 0);
+    if (V == 0) return 0;
+
+    DFSEngine<G> dfs(graph);
+    PearceVisitor visitor(componentId, V);
+    for (int i = 0; i < V; i++) dfs.run(i, visitor);
+
+    // Labels used are label + 1 .. V - 1; the last SCC found (a source
+    // of the condensation) becomes 0
+    int first = visitor.label + 1;
+    for (int& id : componentId) id -= first;
+    return V - first;
+}
+
+} // namespace
+
+// Function: pearceSCCLabels
+// Parameters:
+// const IGraph& graph - reference to a graph implementing IGraph
+// vector<int>& componentId - output mapping from vertex to SCC index
+// Output:
+// Returns the number of SCCs
+int pearceSCCLabels(const IGraph& graph, vector<int>& componentId) {
+    return dispatchGraph(graph, [&](const auto& g) {
+        return pearceLabels(g, componentId);
+    });
+}
+
+// Function: pearceSCC
+// Parameters:
+// const IGraph& graph - reference to a graph implementing IGraph
+// vector<int>& componentId - output mapping from vertex to SCC index
+// Output:
+// Returns SCC list (each SCC is a vector of vertices)
+vector<vector<int>> pearceSCC(const IGraph& graph, vector<int>& componentId) {
+    int count = pearceSCCLabels(graph, componentId);
+
+    vector<int> sizes(count, 0);
+    for (int id : componentId) sizes[id]++;
+
+    vector<vector<int>> sccs(count);
+    for (int i = 0; i < count; i++) sccs[i].reserve(sizes[i]);
+    for (int v = 0; v < (int)componentId.size(); v++) sccs[componentId[v]].push_back(v);
+
+    return sccs;
+}
@@ -8,24 +8,59 @@
 //     is discovered is always via the shortest path.
 //   - distance[v] stores number of edges from start to v.
 //   - parent[v] stores the previous vertex used to reach v.
+//   - The BFS lives in StaticAlgorithms::bfsShortestPaths and is
+//     dispatched on the concrete graph type
+//   - The direction-optimizing variant keeps the frontier as a queue
+//     in top-down steps and as a bitmap in bottom-up steps
+//   - The bidirectional query grows one level at a time from the side
+//     with the smaller frontier and checks every newly discovered
+//     vertex against the other side
 //***************************************************************
 
 #include "Shortest_Path_Unweighted.h"
-#include <queue>
+#include "Graph_Dispatch.h"
+#include "Static_Graph_Algorithms.h"
+#include <cstdint>
+#include <climits>
+#include <algorithm>
 using namespace std;
 
-// Function: bfsShortestPaths
+namespace {
+
+// Function: testBit / setBit
 // Parameters:
-// const IGraph& graph - reference to any object implementing IGraph
+// const vector<uint64_t>& bits - bitmap
+// int v - bit index
+// Output:
+// Reads or sets bit v
+inline bool testBit(const vector<uint64_t>& bits, int v) {
+    return (bits[v >> 6] >> (v & 63)) & 1ULL;
+}
+
+inline void setBit(vector<uint64_t>& bits, int v) {
+    bits[v >> 6] |= 1ULL << (v & 63);
+}
+
+// Function: directionOptimizingBFS
+// Parameters:
+// const G& graph - concrete graph type
 // int start - starting vertex
-// vector<int>& distance - output distances from start
-// vector<int>& parent - output parent pointers
+// vector<int>& distance - output distances
+// vector<int>& parent - output parents
+// const BFSDirectionOptions& options - switch points
+// BFSTraversalStats& stats - work counters
 // Output:
-// Fills distance and parent arrays
-void bfsShortestPaths(const IGraph& graph,
-                      int start,
-                      vector<int>& distance,
-                      vector<int>& parent) {
+// Fills distance and parent arrays level by level
+// Notes:
+// - edgesToCheck tracks the in-edges of still unvisited vertices,
+//   i.e. the work a bottom-up step would do at most
+template <typename G>
+void directionOptimizingBFS(const G& graph,
+                            int start,
+                            vector<int>& distance,
+                            vector<int>& parent,
+                            const BFSDirectionOptions& options,
+                            BFSTraversalStats& stats) {
     int V = graph.getVertexCount();
 
     if (V == 0 || start < 0 || start >= V) {
@@ -36,26 +71,356 @@ void bfsShortestPaths(const IGraph& graph,
 
     distance.assign(V, -1);
     parent.assign(V, -1);
-
-    queue<int> q;
-    q.push(start);
     distance[start] = 0;
 
-    while (!q.empty()) {
-        int u = q.front();
-        q.pop();
+    long long edgesToCheck = 0;
+    for (int v = 0; v < V; v++) edgesToCheck += graph.getInDegree(v);
+    edgesToCheck -= graph.getInDegree(start);
+
+    vector<int> frontier(1, start);
+    vector<int> next;
+    vector<uint64_t> frontierBits;
+    vector<uint64_t> nextBits;
+
+    long long frontierEdges = graph.getOutDegree(start);
+    long long frontierSize = 1;
+    long long previousSize = 0;
+    bool bottomUp = false;
+    int level = 0;
+
+    long long alpha = max(1, options.alpha);
+    long long beta = max(1, options.beta);
+
+    while (frontierSize > 0) {
+        // 1) Pick the direction of this step
+        if (!bottomUp && frontierSize > previousSize && frontierEdges > edgesToCheck / alpha) {
+            frontierBits.assign((V + 63) / 64, 0);
+            for (int u : frontier) setBit(frontierBits, u);
+            bottomUp = true;
+        } else if (bottomUp && frontierSize < previousSize && frontierSize < V / beta) {
+            frontier.clear();
+            for (size_t w = 0; w < frontierBits.size(); w++) {
+                uint64_t word = frontierBits[w];
+                while (word) {
+                    frontier.push_back((int)(w * 64 + __builtin_ctzll(word)));
+                    word &= word - 1;
+                }
+            }
+            bottomUp = false;
+        }
+
+        previousSize = frontierSize;
+        frontierSize = 0;
+        frontierEdges = 0;
+
+        // 2) Expand one level
+        if (bottomUp) {
+            stats.bottomUpSteps++;
+            nextBits.assign(frontierBits.size(), 0);
+
+            for (int v = 0; v < V; v++) {
+                if (distance[v] != -1) continue;
+
+                graph.forEachInNeighbor(v, [&](int w) {
+                    stats.edgesInspected++;
+                    if (w < 0 || w >= V || !testBit(frontierBits, w)) return true;
+
+                    distance[v] = level + 1;
+                    parent[v] = w;
+                    return false;
+                });
+
+                if (distance[v] != -1) {
+                    setBit(nextBits, v);
+                    frontierSize++;
+                    frontierEdges += graph.getOutDegree(v);
+                    edgesToCheck -= graph.getInDegree(v);
+                }
+            }
+
+            frontierBits.swap(nextBits);
+        } else {
+            stats.topDownSteps++;
+            next.clear();
+
+            for (int u : frontier) {
+                graph.forEachNeighbor(u, [&](int v) {
+                    stats.edgesInspected++;
+                    if (v < 0 || v >= V || distance[v] != -1) return;
+
+                    distance[v] = level + 1;
+                    parent[v] = u;
+                    next.push_back(v);
+                    frontierEdges += graph.getOutDegree(v);
+                    edgesToCheck -= graph.getInDegree(v);
+                });
+            }
+
+            frontierSize = (long long)next.size();
+            frontier.swap(next);
+        }
+
+        level++;
+    }
+}
+
+// Function: expandLevel
+// Parameters:
+// const G& graph - concrete graph type
+// bool backward - true to follow incoming edges
+// vector<int>& frontier - current level of this side (replaced by the next)
+// vector<int>& next - scratch buffer
+// vector<unsigned int>& stamp / distance / parent - this side's arrays
+// const vector<unsigned int>& otherStamp - the other side's stamps
+// const vector<int>& otherDistance - the other side's distances
+// unsigned int current - stamp of the query
+// int& best - shortest meeting length found so far
+// int& meet - vertex where best was found
+// BidirectionalBFSStats& stats - work counters
+// Output:
+// Discovers the next level of one side and records meetings
+template <typename G>
+void expandLevel(const G& graph,
+                 bool backward,
+                 vector<int>& frontier,
+                 vector<int>& next,
+                 vector<unsigned int>& stamp,
+                 vector<int>& distance,
+                 vector<int>& parent,
+                 const vector<unsigned int>& otherStamp,
+                 const vector<int>& otherDistance,
+                 unsigned int current,
+                 int& best,
+                 int& meet,
+                 BidirectionalBFSStats& stats) {
+    int V = graph.getVertexCount();
+    next.clear();
+
+    for (int u : frontier) {
+        auto visit = [&](int v) {
+            stats.edgesInspected++;
+            if (v < 0 || v >= V || stamp[v] == current) return;
 
-        for (int v : graph.getNeighbors(u)) {
-            if (v < 0 || v >= V) continue;
+            stamp[v] = current;
+            distance[v] = distance[u] + 1;
+            parent[v] = u;
+            next.push_back(v);
+            stats.verticesVisited++;
 
-            // If v has not been visited, we found the shortest path to it
-            if (distance[v] == -1) {
-                distance[v] = distance[u] + 1;
-                parent[v] = u;
-                q.push(v);
+            if (otherStamp[v] == current && distance[v] + otherDistance[v] < best) {
+                best = distance[v] + otherDistance[v];
+                meet = v;
             }
+        };
+
+        if (backward) {
+            graph.forEachInNeighbor(u, visit);
+        } else {
+            graph.forEachNeighbor(u, visit);
         }
     }
+
+    frontier.swap(next);
+}
+
+// Function: bidirectionalSearch
+// Parameters:
+// const G& graph - concrete graph type
+// int start - source vertex (valid)
+// int target - destination vertex (valid, != start)
+// BidirectionalBFSWorkspace& ws - prepared workspace
+// const BidirectionalBFSOptions& options - distance limit
+// BidirectionalBFSStats& stats - work counters
+// Output:
+// Returns the meeting vertex of a shortest path, or -1 if none
+// Notes:
+// - With both sides fully expanded to depths df and db, every path of
+//   length <= df + db has a vertex seen by both, so the first level
+//   that produces a meeting also produces the shortest one
+template <typename G>
+int bidirectionalSearch(const G& graph,
+                        int start,
+                        int target,
+                        BidirectionalBFSWorkspace& ws,
+                        const BidirectionalBFSOptions& options,
+                        BidirectionalBFSStats& stats) {
+    unsigned int current = ws.stamp;
+
+    ws.forwardStamp[start] = current;
+    ws.forwardDistance[start] = 0;
+    ws.forwardParent[start] = -1;
+    ws.backwardStamp[target] = current;
+    ws.backwardDistance[target] = 0;
+    ws.backwardParent[target] = -1;
+    stats.verticesVisited = 2;
+
+    ws.forwardFrontier.assign(1, start);
+    ws.backwardFrontier.assign(1, target);
+
+    int best = INT_MAX;
+    int meet = -1;
+    int depth = 0;  // forwardSteps + backwardSteps
+
+    while (!ws.forwardFrontier.empty() && !ws.backwardFrontier.empty()) {
+        if (options.maxDistance >= 0 && depth >= options.maxDistance) break;
+
+        if (ws.forwardFrontier.size() <= ws.backwardFrontier.size()) {
+            expandLevel(graph, false, ws.forwardFrontier, ws.next,
+                        ws.forwardStamp, ws.forwardDistance, ws.forwardParent,
+                        ws.backwardStamp, ws.backwardDistance,
+                        current, best, meet, stats);
+            stats.forwardSteps++;
+        } else {
+            expandLevel(graph, true, ws.backwardFrontier, ws.next,
+                        ws.backwardStamp, ws.backwardDistance, ws.backwardParent,
+                        ws.forwardStamp, ws.forwardDistance,
+                        current, best, meet, stats);
+            stats.backwardSteps++;
+        }
+        depth++;
+
+        if (meet != -1) break;
+    }
+
+    return meet;
+}
+
+} // namespace
+
+// Function: bfsShortestPaths
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - starting vertex
+// vector<int>& distance - output distances from start
+// vector<int>& parent - output parent pointers
+// Output:
+// Fills distance and parent arrays
+void bfsShortestPaths(const IGraph& graph,
+                      int start,
+                      vector<int>& distance,
+                      vector<int>& parent) {
+    dispatchGraph(graph, [&](const auto& g) {
+        StaticAlgorithms::bfsShortestPaths(g, start, distance, parent);
+    });
+}
+
+// Function: bfsShortestPaths
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - starting vertex
+// vector<int>& distance - output distances from start
+// vector<int>& parent - output parent pointers
+// const BFSDirectionOptions& options - switch points
+// BFSTraversalStats* stats - optional work counters
+// Output:
+// Fills distance and parent arrays with the direction-optimizing BFS
+void bfsShortestPaths(const IGraph& graph,
+                      int start,
+                      vector<int>& distance,
+                      vector<int>& parent,
+                      const BFSDirectionOptions& options,
+                      BFSTraversalStats* stats) {
+    BFSTraversalStats local;
+    dispatchGraph(graph, [&](const auto& g) {
+        directionOptimizingBFS(g, start, distance, parent, options, local);
+    });
+    if (stats) *stats = local;
+}
+
+// Function: BidirectionalBFSWorkspace::startQuery
+// Parameters:
+// int V - vertex count of the graph
+// Output:
+// Resizes the arrays if needed and advances the stamp
+unsigned int BidirectionalBFSWorkspace::startQuery(int V) {
+    if ((int)forwardStamp.size() != V) {
+        forwardStamp.assign(V, 0);
+        backwardStamp.assign(V, 0);
+        forwardDistance.assign(V, 0);
+        backwardDistance.assign(V, 0);
+        forwardParent.assign(V, -1);
+        backwardParent.assign(V, -1);
+        stamp = 0;
+    }
+
+    stamp++;
+    if (stamp == 0) {
+        fill(forwardStamp.begin(), forwardStamp.end(), 0);
+        fill(backwardStamp.begin(), backwardStamp.end(), 0);
+        stamp = 1;
+    }
+    return stamp;
+}
+
+// Function: bidirectionalShortestPath
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - source vertex
+// int target - destination vertex
+// vector<int>& path - output shortest path (inclusive)
+// BidirectionalBFSWorkspace& workspace - scratch arrays reused across calls
+// const BidirectionalBFSOptions& options - distance limit
+// BidirectionalBFSStats* stats - optional work counters
+// Output:
+// Returns the distance start -> target, or -1 if there is none
+// Notes:
+// - The path is the forward parents from the meeting vertex back to
+//   start, followed by the backward parents on to target
+int bidirectionalShortestPath(const IGraph& graph,
+                              int start,
+                              int target,
+                              vector<int>& path,
+                              BidirectionalBFSWorkspace& workspace,
+                              const BidirectionalBFSOptions& options,
+                              BidirectionalBFSStats* stats) {
+    BidirectionalBFSStats local;
+    path.clear();
+
+    int V = graph.getVertexCount();
+    if (start < 0 || start >= V || target < 0 || target >= V) {
+        if (stats) *stats = local;
+        return -1;
+    }
+
+    if (start == target) {
+        path.push_back(start);
+        local.verticesVisited = 1;
+        if (stats) *stats = local;
+        return 0;
+    }
+
+    workspace.startQuery(V);
+
+    int meet = dispatchGraph(graph, [&](const auto& g) {
+        return bidirectionalSearch(g, start, target, workspace, options, local);
+    });
+    if (stats) *stats = local;
+
+    if (meet == -1) return -1;
+
+    for (int v = meet; v != -1; v = workspace.forwardParent[v]) path.push_back(v);
+    reverse(path.begin(), path.end());
+    for (int v = workspace.backwardParent[meet]; v != -1; v = workspace.backwardParent[v]) {
+        path.push_back(v);
+    }
+
+    return (int)path.size() - 1;
+}
+
+// Function: bidirectionalShortestPath
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - source vertex
+// int target - destination vertex
+// vector<int>& path - output shortest path (inclusive)
+// Output:
+// Runs one query with a temporary workspace
+int bidirectionalShortestPath(const IGraph& graph,
+                              int start,
+                              int target,
+                              vector<int>& path) {
+    BidirectionalBFSWorkspace workspace;
+    return bidirectionalShortestPath(graph, start, target, path, workspace);
 }
 
 // Function: reconstructPath
@@ -0,0 +1,146 @@
+//***************************************************************
+// File: Shortest_Path_Weighted.cpp
+// Description:
+//   Implements Dijkstra's algorithm for graphs with non-negative edge
+//   weights.
+//
+// Notes:
+//   - Vertices leave the heap in order of distance, so a popped vertex
+//     is settled: no later path can be lighter
+//   - A vertex is queued at most once at a time; a lighter path found
+//     later lowers its key in place instead of adding a duplicate
+//   - No separate settled flags: a settled vertex already has a
+//     distance <= any new candidate, so the relax test rejects it
+//   - The search is a template over the concrete graph type
+//     (Graph_Dispatch.h), so the weighted neighbor loop is inlined
+//***************************************************************
+
+#include "Shortest_Path_Weighted.h"
+#include "Shortest_Path_Unweighted.h"
+#include "Graph_Dispatch.h"
+#include "Indexed_DAry_Heap.h"
+using namespace std;
+
+namespace {
+
+// Function: runDijkstra
+// Parameters:
+// const G& graph - concrete graph type
+// int start - starting vertex (valid)
+// vector<EdgeWeight>& distance - output distances (sized V, all -1)
+// vector<int>& parent - output parents (sized V, all -1)
+// const DijkstraOptions& options - target / distance limit
+// DijkstraStats& stats - work counters
+// Output:
+// Settles vertices in distance order until the heap empties or the
+// target is settled
+template <typename G>
+void runDijkstra(const G& graph,
+                 int start,
+                 vector<EdgeWeight>& distance,
+                 vector<int>& parent,
+                 const DijkstraOptions& options,
+                 DijkstraStats& stats) {
+    int V = graph.getVertexCount();
+    EdgeWeight limit = options.maxDistance;
+
+    IndexedDAryHeap<4> heap(V);
+
+    distance[start] = 0;
+    heap.pushOrDecrease(start, 0);
+    stats.heapUpdates++;
+
+    while (!heap.empty()) {
+        EdgeWeight d;
+        int u = heap.pop(d);
+        stats.settled++;
+
+        if (u == options.target) break;
+
+        graph.forEachWeightedNeighbor(u, [&](int v, EdgeWeight w) {
+            stats.edgesInspected++;
+            if (v < 0 || v >= V || w < 0) return;  // safety guard
+
+            EdgeWeight candidate = d + w;
+            if (limit >= 0 && candidate > limit) return;
+            if (distance[v] != -1 && candidate >= distance[v]) return;
+
+            distance[v] = candidate;
+            parent[v] = u;
+            heap.pushOrDecrease(v, candidate);
+            stats.heapUpdates++;
+        });
+    }
+
+    // Early stop: drop the tentative distances still queued
+    for (int i = 0; i < heap.size(); i++) {
+        int v = heap.vertexAt(i);
+        distance[v] = -1;
+        parent[v] = -1;
+    }
+}
+
+} // namespace
+
+// Function: dijkstraShortestPaths
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - starting vertex
+// vector<EdgeWeight>& distance - output distances from start
+// vector<int>& parent - output parent pointers
+// const DijkstraOptions& options - target / distance limit
+// DijkstraStats* stats - optional work counters
+// Output:
+// Fills distance and parent arrays
+void dijkstraShortestPaths(const IGraph& graph,
+                           int start,
+                           vector<EdgeWeight>& distance,
+                           vector<int>& parent,
+                           const DijkstraOptions& options,
+                           DijkstraStats* stats) {
+    int V = graph.getVertexCount();
+    DijkstraStats local;
+
+    if (start < 0 || start >= V) {
+        distance.clear();
+        parent.clear();
+        if (stats) *stats = local;
+        return;
+    }
+
+    distance.assign(V, -1);
+    parent.assign(V, -1);
+
+    dispatchGraph(graph, [&](const auto& g) {
+        runDijkstra(g, start, distance, parent, options, local);
+    });
+    if (stats) *stats = local;
+}
+
+// Function: dijkstraShortestPath
+// Parameters:
+// const IGraph& graph - reference to any object implementing IGraph
+// int start - source vertex
+// int target - destination vertex
+// vector<int>& path - output lightest path (inclusive)
+// Output:
+// Returns the path weight, or -1 if there is no path
+EdgeWeight dijkstraShortestPath(const IGraph& graph,
+                                int start,
+                                int target,
+                                vector<int>& path) {
+    path.clear();
+    int V = graph.getVertexCount();
+    if (start < 0 || start >= V || target < 0 || target >= V) return -1;
+
+    DijkstraOptions options;
+    options.target = target;
+
+    vector<EdgeWeight> distance;
+    vector<int> parent;
+    dijkstraShortestPaths(graph, start, distance, parent, options);
+
+    if (distance[target] == -1) return -1;
+    path = reconstructPath(start, target, parent);
+    return distance[target];
+}
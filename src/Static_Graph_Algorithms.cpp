@@ -0,0 +1,57 @@
+//***************************************************************
+// File: Static_Graph_Algorithms.cpp
+// Description:
+//   Explicit instantiations of the static-dispatch algorithm
+//   templates for the graph classes shipped with the project.
+//
+// Notes:
+//   - The header declares these as extern templates, so every other
+//     translation unit links against this single copy
+//   - Other graph types still instantiate implicitly from the header
+//***************************************************************
+
+#include "Static_Graph_Algorithms.h"
+
+namespace StaticAlgorithms {
+
+template vector<int> bfsOrder<ListGraph>(const ListGraph&, int);
+template vector<int> bfsOrder<MatrixGraph>(const MatrixGraph&, int);
+template vector<int> bfsOrder<CSRGraph>(const CSRGraph&, int);
+template vector<int> bfsOrder<CompressedGraph>(const CompressedGraph&, int);
+
+template vector<int> dfsOrder<ListGraph>(const ListGraph&, int);
+template vector<int> dfsOrder<MatrixGraph>(const MatrixGraph&, int);
+template vector<int> dfsOrder<CSRGraph>(const CSRGraph&, int);
+template vector<int> dfsOrder<CompressedGraph>(const CompressedGraph&, int);
+
+template void bfsShortestPaths<ListGraph>(const ListGraph&, int, vector<int>&, vector<int>&);
+template void bfsShortestPaths<MatrixGraph>(const MatrixGraph&, int, vector<int>&, vector<int>&);
+template void bfsShortestPaths<CSRGraph>(const CSRGraph&, int, vector<int>&, vector<int>&);
+template void bfsShortestPaths<CompressedGraph>(const CompressedGraph&, int, vector<int>&, vector<int>&);
+
+template bool hasCycle<ListGraph>(const ListGraph&);
+template bool hasCycle<MatrixGraph>(const MatrixGraph&);
+template bool hasCycle<CSRGraph>(const CSRGraph&);
+template bool hasCycle<CompressedGraph>(const CompressedGraph&);
+
+template bool topologicalSort<ListGraph>(const ListGraph&, vector<int>&);
+template bool topologicalSort<MatrixGraph>(const MatrixGraph&, vector<int>&);
+template bool topologicalSort<CSRGraph>(const CSRGraph&, vector<int>&);
+template bool topologicalSort<CompressedGraph>(const CompressedGraph&, vector<int>&);
+
+template vector<vector<int>> kosarajuSCC<ListGraph>(const ListGraph&, vector<int>&);
+template vector<vector<int>> kosarajuSCC<MatrixGraph>(const MatrixGraph&, vector<int>&);
+template vector<vector<int>> kosarajuSCC<CSRGraph>(const CSRGraph&, vector<int>&);
+template vector<vector<int>> kosarajuSCC<CompressedGraph>(const CompressedGraph&, vector<int>&);
+
+template bool bipartiteColoring<ListGraph>(const ListGraph&, vector<int>&);
+template bool bipartiteColoring<MatrixGraph>(const MatrixGraph&, vector<int>&);
+template bool bipartiteColoring<CSRGraph>(const CSRGraph&, vector<int>&);
+template bool bipartiteColoring<CompressedGraph>(const CompressedGraph&, vector<int>&);
+
+template bool isConnected<ListGraph>(const ListGraph&);
+template bool isConnected<MatrixGraph>(const MatrixGraph&);
+template bool isConnected<CSRGraph>(const CSRGraph&);
+template bool isConnected<CompressedGraph>(const CompressedGraph&);
+
+} // namespace StaticAlgorithms
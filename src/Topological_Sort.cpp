@@ -14,11 +14,13 @@
 // Notes:
 //   - Time Complexity: O(V + E)
 //   - Space Complexity: O(V)
+//   - The algorithm lives in StaticAlgorithms::topologicalSort and
+//     is dispatched on the concrete graph type
 //***************************************************************
 
 #include "Topological_Sort.h"
-#include <queue>
-using namespace std;
+#include "Graph_Dispatch.h"
+#include "Static_Graph_Algorithms.h"
 
 // Function: topologicalSort
 // Parameters:
@@ -27,48 +29,7 @@ using namespace std;
 // Output:
 // Returns true if a valid topological order exists, false otherwise
 bool topologicalSort(const IGraph& graph, vector<int>& order) {
-    int V = graph.getVertexCount();
-    order.clear();
-
-    // Topological sort is defined only for directed graphs
-    if (!graph.isDirected()) return false;
-
-    vector<int> indegree(V, 0);
-
-    // Compute in-degree of each vertex
-    for (int u = 0; u < V; u++) {
-        for (int v : graph.getNeighbors(u)) {
-            if (v < 0 || v >= V) continue;
-            indegree[v]++;
-        }
-    }
-
-    queue<int> q;
-
-    // Enqueue all vertices with in-degree 0
-    for (int i = 0; i < V; i++) {
-        if (indegree[i] == 0) {
-            q.push(i);
-        }
-    }
-
-    // Process vertices
-    while (!q.empty()) {
-        int u = q.front();
-        q.pop();
-
-        order.push_back(u);
-
-        for (int v : graph.getNeighbors(u)) {
-            if (v < 0 || v >= V) continue;
-
-            indegree[v]--;
-            if (indegree[v] == 0) {
-                q.push(v);
-            }
-        }
-    }
-
-    // If not all vertices were processed, a cycle exists
-    return ((int)order.size() == V);
+    return dispatchGraph(graph, [&](const auto& g) {
+        return StaticAlgorithms::topologicalSort(g, order);
+    });
 }
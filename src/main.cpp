@@ -4,33 +4,131 @@
 //   Entry point for the Graph project.
 //
 //   Responsibilities:
-//     - Create a graph object using GraphFactory
+//     - Create a graph object using GraphFactory, load one from a
+//       binary graph file, or import a text edge list
 //     - Delegate all user interaction to Graph_CLI
 //     - Clean up allocated memory
 //
+// Usage:
+//   graph                      build a graph interactively
+//   graph <file.bin>           load and verify a binary graph file (mmap)
+//         [--trust]            skip verifying the body (O(1) load of a
+//                              file known to be intact)
+//   graph --import <file.txt>  import an edge list / Matrix Market file
+//         [--directed]         treat an edge list as directed
+//   --save <file.bin>          also save the graph (any mode above)
+//   --compress                 run on a gap/varint compressed copy
+//
 // Notes:
 //   - Keeping main.cpp small makes the project easier to maintain
 //***************************************************************
 
 #include "GraphFactory.h"
 #include "Graph_CLI.h"
+#include "Graph_Binary_Format.h"
+#include "Graph_Text_Import.h"
+#include "Compressed_Implementation_Graph.h"
 
 #include <iostream>
+#include <string>
 using namespace std;
 
+// Function: printUsage
+// Parameters:
+// const char* program - program name (argv[0])
+// Output:
+// Prints the command line usage
+static void printUsage(const char* program) {
+    cout << "Usage: " << program
+         << " [<file.bin> [--trust] | --import <file.txt> [--directed]] [--save <file.bin>]"
+         << " [--compress]" << endl;
+}
+
 // Function: main
 // Parameters:
-// None
+// int argc - argument count
+// char* argv[] - arguments (see Usage above)
 // Output:
-// Creates a graph and runs the CLI controller
-int main() {
-    IGraph* graph = selectAndCreateGraph();
+// Creates or loads a graph and runs the CLI controller
+int main(int argc, char* argv[]) {
+    IGraph* graph = NULL;
+    string binaryFile, importFile, saveFile;
+    bool importDirected = false;
+    bool trustBinary = false;
+    bool compress = false;
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+
+        if (arg == "--save" && i + 1 < argc) {
+            saveFile = argv[++i];
+        } else if (arg == "--import" && i + 1 < argc) {
+            importFile = argv[++i];
+        } else if (arg == "--directed") {
+            importDirected = true;
+        } else if (arg == "--trust") {
+            trustBinary = true;
+        } else if (arg == "--compress") {
+            compress = true;
+        } else if (arg[0] != '-' && binaryFile.empty()) {
+            binaryFile = arg;
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((!binaryFile.empty() && !importFile.empty()) || (trustBinary && binaryFile.empty())) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    if (!binaryFile.empty()) {
+        // The file comes from the user: verify every offset and target
+        // before any algorithm indexes arrays with them, unless told
+        // the file is intact
+        string error;
+        BinaryLoadMode mode = trustBinary ? BinaryLoadMode::TrustBody : BinaryLoadMode::Verify;
+        graph = loadBinaryGraph(binaryFile, mode, &error);
+        if (graph == NULL) {
+            cout << "Failed to load " << binaryFile << ": " << error << endl;
+            return 1;
+        }
+        cout << "Loaded binary graph (" << graph->getVertexCount() << " vertices)" << endl;
+    } else if (!importFile.empty()) {
+        TextImportOptions options;
+        options.directed = importDirected;
+
+        ImportReport report;
+        graph = importTextGraph(importFile, options, &report);
+        printImportReport(report);
+        if (graph == NULL) return 1;
+        cout << "Imported graph (" << graph->getVertexCount() << " vertices)" << endl;
+    } else {
+        graph = selectAndCreateGraph();
+    }
 
     if (graph == NULL) {
         cout << "Failed to create graph." << endl;
         return 1;
     }
 
+    if (!saveFile.empty()) {
+        if (writeBinaryGraph(*graph, saveFile)) {
+            cout << "Graph saved to " << saveFile << endl;
+        } else {
+            cout << "Failed to save graph to " << saveFile << endl;
+        }
+    }
+
+    if (compress) {
+        CompressedGraph* compressed = new CompressedGraph(*graph);
+        delete graph;
+        graph = compressed;
+        cout << "Compressed to " << compressed->getEncodedBytes() << " bytes for "
+             << compressed->getEdgeEntryCount() << " adjacency entries" << endl;
+    }
+
     runGraphCLI(*graph);
 
     delete graph;